@@ -0,0 +1,22 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "basinMap.h"
+
+int main(int, char**) {
+    const std::vector<cf::Color> palette = cf::readPaletteFromFile(std::string(CHAOS_FILE_PATH) + "Topo.pal");
+
+    // basin of the henon attractor, all other starting points escape
+    cf::Orbit orb;
+    orb.read(std::string(CHAOS_FILE_PATH) + "Henon.orb");
+    cf::WindowVectorized window(800, cf::Interval(-2.f, 2.f), cf::Interval(-2.f, 2.f), "Henon basin");
+    cf::BasinMap(orb).render(window, palette);
+    window.show();
+
+    window.waitKey();
+    return 0;
+}
@@ -0,0 +1,32 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "bifurcationDiagram.h"
+
+int main(int argc, char** argv) {
+    std::string filePath;
+    if (argc < 2) {
+        std::cout << "Please provide a .orb file, if you want a different orb file\n\n\n";
+        filePath = CHAOS_FILE_PATH;
+        filePath += "Feigenb.orb";
+    } else
+        filePath = argv[1];
+
+    cf::Orbit orb;
+    orb.read(filePath);
+
+    // sweep factor 'i' (index 8) along the x axis
+    // and display the x coordinate of the orbit on the y axis
+    cf::WindowVectorized window(1024, cf::Interval(-0.25f, 1.f), cf::Interval(-1.5f, 1.5f));
+    cf::BifurcationDiagram diagram(orb, 8);
+    diagram.setIterations(1000, 100000);
+    diagram.render(window, cf::readPaletteFromFile(std::string(CHAOS_FILE_PATH) + "Mandel.pal"));
+
+    window.show();
+    window.waitKey();
+    return 0;
+}
@@ -0,0 +1,39 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "cellularAutomaton.h"
+
+#include <chrono>
+#include <iostream>
+
+int main(int, char**) {
+    // rule strings are dispatched to pre-instantiated kernels, other rules use the generic kernel
+    cf::WindowRasterized window(768, 768, "Cellular Automaton");
+    for (const char* rule : {"B3/S23", "B36/S23", "B3678/S34678", "B2/S/C3", "B2/S345/C4", "B34/S34"}) {
+        cf::CellularAutomaton automaton(1024, 1024, rule);
+        automaton.randomize(rule == std::string("B3678/S34678") ? 0.5 : 0.2, 42);
+        const auto start = std::chrono::steady_clock::now();
+        automaton.step(200);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << automaton.getRule().toString() << (automaton.hasCompiledKernel() ? " (compiled): " : " (generic): ")
+                  << 1024.0 * 1024.0 * 200.0 / seconds * 1e-9 << " G cell updates/s, population "
+                  << automaton.getPopulation() << '\n';
+        automaton.render(window, cf::Color(255, 220, 80), cf::Color(20, 20, 40));
+        window.show();
+        window.waitKey(1000);
+    }
+
+    // any rule can be compiled into the kernel
+    cf::CellularAutomaton automaton(1024, 1024);
+    automaton.setRule<cf::ca::StaticRule<cf::ca::counts(3, 4), cf::ca::counts(3, 4)>>();
+    automaton.randomize(0.2, 42);
+    automaton.step(200);
+    automaton.render(window);
+    window.show();
+    window.waitKey();
+    return 0;
+}
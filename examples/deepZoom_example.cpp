@@ -0,0 +1,29 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "deepZoom.h"
+
+int main(int, char**) {
+    const std::vector<cf::Color> palette = cf::readPaletteFromFile(std::string(CHAOS_FILE_PATH) + "Mandel.pal");
+
+    // boundary point of the mandelbrot set, resolved down to a view width of about 1e-100
+    cf::DeepZoom zoom("-0.744483565412290404464797651361760163813795067922613257074243005990413844520135675748182056991413858579516941405250",
+                      "0.099236693556054497621071124224220046613830511700770139857073176331031985123175791385138871069495081996064858593749",
+                      1e-100);
+    zoom.setMaxIterations(100000);
+
+    // only the image size of the window is used
+    cf::WindowVectorized window(800, cf::Interval(0.f, 4.f), cf::Interval(0.f, 3.f), "Deep zoom 1e-100");
+    const cf::DeepZoom::Result result = zoom.calculate(window.getWidth(), window.getHeight());
+    std::cout << "reference orbit: " << result.referenceLength << " iterations, " << result.rebases << " rebases, "
+              << result.skippedIterations << " iterations skipped by the series approximation\n";
+    cf::EscapeTime::render(result, window, palette);
+    window.show();
+
+    window.waitKey();
+    return 0;
+}
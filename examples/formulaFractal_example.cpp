@@ -0,0 +1,50 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "formulaFractal.h"
+
+int main(int, char**) {
+    namespace f = cf::formula;
+    const std::vector<cf::Color> palette = cf::readPaletteFromFile(std::string(CHAOS_FILE_PATH) + "Mandel.pal");
+
+    // escape time variants, every formula is a distinct type -> its own inlined iteration loop
+    cf::WindowVectorized shipWindow(600, cf::Interval(-2.2f, 1.3f), cf::Interval(-1.9f, 0.8f), "Burning Ship");
+    cf::makeFormulaFractal(f::burningShip()).render(shipWindow, palette);
+    shipWindow.show();
+
+    cf::WindowVectorized multibrotWindow(600, cf::Interval(-1.5f, 1.5f), cf::Interval(-1.5f, 1.5f), "Multibrot z^5 + c");
+    cf::makeFormulaFractal(f::multibrot<5>()).render(multibrotWindow, palette);
+    multibrotWindow.show();
+
+    cf::WindowVectorized phoenixWindow(600, cf::Interval(-1.8f, 1.8f), cf::Interval(-1.4f, 1.4f), "Phoenix");
+    auto phoenix = cf::FormulaFractal<decltype(f::phoenix(-0.5))>::Julia(f::phoenix(-0.5), 0.5667);
+    phoenix.setMaxIterations(500);
+    phoenix.render(phoenixWindow, palette);
+    phoenixWindow.show();
+
+    // custom formula: z' = z^3 + conj(z) * c
+    cf::WindowVectorized customWindow(600, cf::Interval(-1.5f, 1.5f), cf::Interval(-1.5f, 1.5f), "z^3 + conj(z) * c");
+    auto custom = cf::makeFormulaFractal(f::pow<3>(f::z()) + f::conj(f::z()) * f::c());
+    custom.setEscapeRadius(10.0);
+    custom.render(customWindow, palette);
+    customWindow.show();
+
+    // root basins of Newton's method for z^5 - 1
+    cf::WindowVectorized newtonWindow(600, cf::Interval(-1.5f, 1.5f), cf::Interval(-1.5f, 1.5f), "Newton z^5 - 1");
+    auto newton = cf::makeFormulaFractal(f::newton<5>());
+    newton.setMaxIterations(100);
+    cv::Mat& image = newtonWindow.getImage();
+    const cf::RootBasins basins =
+        newton.calculateRoots(image.cols, image.rows, newtonWindow.getIntervalX(), newtonWindow.getIntervalY());
+    const std::vector<cf::Color> rootColors = {cf::Color::RED, cf::Color::GREEN, cf::Color::BLUE, cf::Color::YELLOW,
+                                               cf::Color::MAGENTA};
+    cf::RootBasins::render(basins, newtonWindow, rootColors);
+    newtonWindow.show();
+
+    newtonWindow.waitKey();
+    return 0;
+}
@@ -0,0 +1,49 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "hashLife.h"
+
+#include <chrono>
+#include <iostream>
+
+int main(int, char**) {
+    // Gosper glider gun: one glider every 30 generations
+    const char* gun[] = {"........................O...........", "......................O.O...........",
+                         "............OO......OO............OO", "...........O...O....OO............OO",
+                         "OO........O.....O...OO..............", "OO........O...O.OO....O.O...........",
+                         "..........O.....O.......O...........", "...........O...O....................",
+                         "............OO......................"};
+    cf::HashLife life;
+    for (int y = 0; y < 9; ++y)
+        for (int x = 0; gun[y][x]; ++x)
+            life.set(x, y, gun[y][x] == 'O');
+
+    cf::WindowRasterized window(800, 800, "HashLife");
+    for (uint64_t generations = 1; generations <= 1000000000; generations *= 10) {
+        const auto start = std::chrono::steady_clock::now();
+        life.run(generations - life.getGeneration());
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "generation " << life.getGeneration() << ": population " << life.getPopulation() << ", "
+                  << life.getNumNodes() << " nodes, " << seconds << " s\n";
+
+        // whole pattern, a pixel covers many cells
+        life.render(window);
+        window.show();
+        window.waitKey(500);
+    }
+
+    // viewport of 200 x 200 cells around the gun
+    life.render(window, -50, -50, 200, 200);
+    window.show();
+
+    // a pattern of a .dat file
+    cf::HashLife pattern = cf::HashLife::FromDATFile(CHAOS_FILE_PATH "Life2.dat");
+    pattern.run(1000000);
+    std::cout << "Life2.dat after 10^6 generations: population " << pattern.getPopulation() << '\n';
+    window.waitKey();
+    return 0;
+}
@@ -0,0 +1,32 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "inverseJulia.h"
+
+#include <chrono>
+#include <iostream>
+
+int main(int, char**) {
+    const std::vector<cf::Color> palette = cf::readPaletteFromFile(std::string(CHAOS_FILE_PATH) + "Mandel.pal");
+
+    // every click sets the parameter c to the clicked position (e.g. near the border of the Mandelbrot set)
+    cf::WindowVectorized window(1024, cf::Interval(-1.6f, 1.6f), cf::Interval(-1.2f, 1.2f), "Julia set (MIIM)");
+    std::complex<double> c(-0.8, 0.156);
+    for (;;) {
+        const auto start = std::chrono::steady_clock::now();
+        window.clear(cf::Color::BLACK);
+        cf::InverseJulia(c).render(window, palette);
+        std::cout << "c = " << c << ": "
+                  << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() << " ms"
+                  << std::endl;
+        window.show();
+
+        const cf::Point p = window.waitMouseInput();
+        c = std::complex<double>(p.x, p.y);
+    }
+    return 0;
+}
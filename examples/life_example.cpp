@@ -0,0 +1,47 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "life.h"
+
+#include <chrono>
+#include <iostream>
+
+int main(int, char**) {
+    // pattern of a .dat file
+    cf::Life life = cf::Life::FromDATFile(CHAOS_FILE_PATH "Life2.dat", 256, 192);
+    cf::WindowRasterized window(768, 576, "Game of Life");
+    for (int i = 0; i < 500; ++i) {
+        life.step();
+        life.render(window);
+        window.show();
+        window.waitKey(10);
+    }
+
+    // soup: random 4096 x 4096 torus, all threads
+    cf::Life soup(4096, 4096);
+    soup.randomize(0.5, 42);
+    const auto start = std::chrono::steady_clock::now();
+    soup.step(1000);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << 4096.0 * 4096.0 * 1000.0 / seconds * 1e-9 << " G cell updates/s, population " << soup.getPopulation()
+              << '\n';
+    soup.render(window);
+    window.show();
+    window.waitKey();
+
+    // the settled soup (still lifes and blinkers) only computes the tiles next to changes
+    soup.step(20000);
+    const auto startLate = std::chrono::steady_clock::now();
+    soup.step(1000);
+    const double secondsLate = std::chrono::duration<double>(std::chrono::steady_clock::now() - startLate).count();
+    std::cout << 4096.0 * 4096.0 * 1000.0 / secondsLate * 1e-9 << " G cell updates/s, changed tiles "
+              << soup.getNumChangedTiles() << '\n';
+    soup.render(window);
+    window.show();
+    window.waitKey();
+    return 0;
+}
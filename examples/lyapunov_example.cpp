@@ -0,0 +1,27 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "lyapunovMap.h"
+
+int main(int, char**) {
+    const std::vector<cf::Color> palette = cf::readPaletteFromFile(std::string(CHAOS_FILE_PATH) + "Topo.pal");
+
+    // Markus-Lyapunov fractal, parameter 'A' on the x axis, 'B' on the y axis
+    cf::WindowVectorized markus(800, cf::Interval(2.f, 4.f), cf::Interval(2.f, 4.f), "Markus-Lyapunov");
+    cf::LyapunovMap::MarkusLyapunov("AABAB").render(markus, palette);
+    markus.show();
+
+    // henon map: factor 'd' (-a in the common notation) on the x axis, factor 'j' (b) on the y axis
+    cf::Orbit orb;
+    orb.read(std::string(CHAOS_FILE_PATH) + "Henon.orb");
+    cf::WindowVectorized henon(800, cf::Interval(-1.5f, -0.5f), cf::Interval(-0.4f, 0.4f), "Henon");
+    cf::LyapunovMap(orb, 3, 9).render(henon, palette);
+    henon.show();
+
+    henon.waitKey();
+    return 0;
+}
@@ -0,0 +1,42 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "colorMap.h"
+
+int main(int, char**) {
+    const std::vector<cf::Color> palette = cf::readPaletteFromFile(std::string(CHAOS_FILE_PATH) + "Mandel.pal");
+
+    cf::WindowVectorized mandelbrot(1024, cf::Interval(-2.2f, 0.8f), cf::Interval(-1.2f, 1.2f), "Mandelbrot");
+    cf::EscapeTime fractal;
+    fractal.setMaxIterations(1000);
+    // only the borders of uniform regions are iterated (the large interior is filled)
+    fractal.setMode(cf::EscapeTime::Mode::MARIANI_SILVER);
+    fractal.render(mandelbrot, palette);
+    mandelbrot.show();
+
+    cf::WindowVectorized julia(1024, cf::Interval(-1.6f, 1.6f), cf::Interval(-1.2f, 1.2f), "Julia");
+    // smooth iteration counts, histogram equalized over the palette
+    cf::EscapeTime juliaFractal = cf::EscapeTime::Julia({-0.8, 0.156});
+    juliaFractal.setEscapeRadius(1000.0);
+    cf::ColorMap colorMap(palette);
+    colorMap.setScaling(cf::ColorMap::Scaling::EQUALIZED);
+    colorMap.render(juliaFractal.calculate(julia.getWidth(), julia.getHeight(), julia.getIntervalX(), julia.getIntervalY()),
+                    julia);
+    julia.show();
+
+    // thin filaments stay connected in small thumbnails without supersampling
+    cf::WindowVectorized thumbnail(256, cf::Interval(-2.2f, 0.8f), cf::Interval(-1.2f, 1.2f), "Distance estimation");
+    fractal.setEscapeRadius(1e10);
+    fractal.setDistanceEstimation(true);
+    cf::EscapeTime::renderDistance(fractal.calculate(thumbnail.getWidth(), thumbnail.getHeight(), thumbnail.getIntervalX(),
+                                                     thumbnail.getIntervalY()),
+                                   thumbnail);
+    thumbnail.show();
+
+    julia.waitKey();
+    return 0;
+}
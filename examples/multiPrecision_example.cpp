@@ -0,0 +1,46 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "colorMap.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+int main(int, char**) {
+    const cf::ColorMap colorMap = cf::ColorMap::FromFile(std::string(CHAOS_FILE_PATH) + "Mandel.pal");
+    const cf::QuadDouble centerReal = cf::QuadDouble::FromString("-0.7444835654122904044647976513617601638137950679");
+    const cf::QuadDouble centerImag = cf::QuadDouble::FromString("0.0992366935560544976210711242242200466138305117");
+    const double viewWidth = 1e-17; // beyond double precision
+
+    cf::EscapeTime fractal;
+    fractal.setMaxIterations(10000);
+
+    // only the image size of the windows is used
+    const std::pair<cf::EscapeTime::Precision, const char*> precisions[] = {
+        {cf::EscapeTime::Precision::DOUBLE, "double"},
+        {cf::EscapeTime::Precision::DOUBLE_DOUBLE, "double double"},
+        {cf::EscapeTime::Precision::QUAD_DOUBLE, "quad double"}};
+    std::vector<std::unique_ptr<cf::WindowVectorized>> windows;
+    for (const auto& precision : precisions) {
+        windows.emplace_back(new cf::WindowVectorized(400, cf::Interval(0.f, 4.f), cf::Interval(0.f, 3.f), precision.second));
+        cf::WindowVectorized& window = *windows.back();
+
+        fractal.setPrecision(precision.first);
+        const auto start = std::chrono::steady_clock::now();
+        const auto result = fractal.calculate(window.getWidth(), window.getHeight(), centerReal, centerImag, viewWidth);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << precision.second << ": " << seconds << " s, " << result.evaluations / seconds * 1e-6
+                  << " M iterations/s\n";
+
+        colorMap.render(result, window);
+        window.show();
+    }
+
+    windows.front()->waitKey();
+    return 0;
+}
@@ -6,6 +6,7 @@
 #endif
 
 #include "ORB.h"
+#include "orbitEngine.h"
 
 int main(int argc, char** argv) {
     // read provided *.orb file
@@ -43,6 +44,21 @@ int main(int argc, char** argv) {
         std::cout << e << std::endl;
     }
 
+    // iterate the first starting point
+    // and stop as soon as the orbit runs into a fixed point or cycle
+    cf::OrbitEngine engine(orb);
+    engine.setCycleDetection(cf::OrbitEngine::CycleHandling::STOP, 1e-9);
+    const glm::vec3& start = orb.getAllStartingPoints().front();
+    const auto result = engine.iterate(glm::dvec2(start.x, start.y), 100000);
+
+    std::cout << "\n\nIterations" << align << result.iterations << '\n';
+    if (result.period)
+        std::cout << "Period" << align << result.period << '\n'
+                  << "Transient length" << align << result.transientLength << '\n';
+    else
+        std::cout << "No cycle detected\n";
+    std::cout << std::endl;
+
     std::cout << "Press enter to finish the process";
     cf::Console::waitKey();
     return 0;
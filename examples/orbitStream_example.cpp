@@ -0,0 +1,38 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "orbitStream.h"
+
+int main(int, char**) {
+    cf::Orbit orb;
+    orb.read(std::string(CHAOS_FILE_PATH) + "Henon.orb");
+
+    // iterate once and store all points
+    {
+        cf::OrbitRecorder recorder("henon.cfos", 1e-6);
+        cf::OrbitEngine(orb).iterate({0.0, 0.0}, 20000000, std::ref(recorder));
+    }
+
+    // replay the same points with two different framings and palettes
+    const cf::OrbitStream stream("henon.cfos");
+    std::cout << stream.getNumRecords() << " records in " << stream.getNumChunks() << " chunks\n";
+
+    cf::WindowVectorized full(800, cf::Interval(-1.5f, 1.5f), cf::Interval(-0.5f, 0.5f), "Henon");
+    cf::DensityCanvas fullCanvas(full);
+    stream.replay(fullCanvas);
+    fullCanvas.render(full);
+    full.show();
+
+    cf::WindowVectorized detail(800, cf::Interval(0.55f, 0.75f), cf::Interval(0.15f, 0.2f), "Henon detail");
+    cf::DensityCanvas detailCanvas(detail);
+    stream.replay(detailCanvas);
+    detailCanvas.render(detail, cf::readPaletteFromFile(std::string(CHAOS_FILE_PATH) + "Mandel.pal"));
+    detail.show();
+
+    detail.waitKey();
+    return 0;
+}
@@ -0,0 +1,49 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "progressiveRenderer.h"
+
+#include <iostream>
+
+int main(int, char**) {
+    const std::vector<cf::Color> palette = cf::readPaletteFromFile(std::string(CHAOS_FILE_PATH) + "Mandel.pal");
+    const int width = 1536;
+    cf::Interval range_x(-2.2f, 0.8f), range_y(-1.125f, 1.125f); // 1536 x 1152 pixels
+
+    cf::WindowVectorized window(width, range_x, range_y, "Progressive Mandelbrot");
+    cf::EscapeTime fractal;
+    fractal.setMaxIterations(2000);
+    cf::ProgressiveRenderer renderer(fractal, palette);
+
+    std::cout << "w/a/s/d: pan, i/o: zoom in/out by 3, q: quit" << std::endl;
+    for (;;) {
+        renderer.render(window, [&](int) {
+            window.show();
+            window.waitKey(1);
+        });
+        std::cout << "reused pixels: " << renderer.getReusedPixels() << std::endl;
+
+        // pans by whole pixels and zooms by 3 keep the pixel centers of the previous view
+        const float step = (range_x.max - range_x.min) / width;
+        const float centerX = 0.5f * (range_x.min + range_x.max), centerY = 0.5f * (range_y.min + range_y.max);
+        const unsigned char key = window.waitKey();
+        float dx = 0.f, dy = 0.f, zoom = 1.f;
+        if (key == 'q')
+            break;
+        else if (key == 'a' || key == 'd')
+            dx = (key == 'a' ? -64.f : 64.f) * step;
+        else if (key == 'w' || key == 's')
+            dy = (key == 's' ? -64.f : 64.f) * step;
+        else if (key == 'i' || key == 'o')
+            zoom = key == 'i' ? 1.f / 3.f : 3.f;
+
+        range_x = cf::Interval(centerX + dx + zoom * (range_x.min - centerX), centerX + dx + zoom * (range_x.max - centerX));
+        range_y = cf::Interval(centerY + dy + zoom * (range_y.min - centerY), centerY + dy + zoom * (range_y.max - centerY));
+        window.setInterval(range_x, range_y, width);
+    }
+    return 0;
+}
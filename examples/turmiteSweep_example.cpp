@@ -0,0 +1,38 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "turmiteSweep.h"
+
+#include <chrono>
+#include <iostream>
+
+int main(int, char**) {
+    // all .ant files and all two letter rules of up to 12 states (2047 rules)
+    cf::TurmiteSweep sweep;
+    for (int i = 0; i <= 14; ++i)
+        sweep.addFile(CHAOS_FILE_PATH "Ant_" + std::to_string(i) + ".ant");
+    for (int numStates = 2; numStates <= 12; ++numStates)
+        sweep.addGeneratedRules(numStates);
+    sweep.setStepBudget(10000000);
+    sweep.setThumbnails(128, cf::readPaletteFromFile(CHAOS_FILE_PATH "Chaos_ant.pal"), ".");
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<cf::TurmiteSweep::Result> results = sweep.run();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    cf::TurmiteSweep::SaveCSV("turmites.csv", results);
+
+    std::size_t highways = 0;
+    for (const cf::TurmiteSweep::Result& result : results) {
+        if (!result.highwayPeriod)
+            continue;
+        ++highways;
+        std::cout << result.name << ": highway period " << result.highwayPeriod << " (" << result.highwayDx << ", "
+                  << result.highwayDy << ")\n";
+    }
+    std::cout << results.size() << " rules, " << highways << " highways, " << seconds << " s\n";
+    return 0;
+}
@@ -0,0 +1,55 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "turmite.h"
+
+#include <chrono>
+#include <iostream>
+
+int main(int, char**) {
+    const std::vector<cf::Color> palette = cf::readPaletteFromFile(CHAOS_FILE_PATH "Chaos_ant.pal");
+    cf::Turmite turmite = cf::Turmite::FromFile(CHAOS_FILE_PATH "Ant_10.ant", 800, 600);
+    cf::WindowRasterized window(800, 600, "Turmite " + turmite.getRule());
+
+    // run in batches and show the intermediate states
+    const uint64_t batch = 20000000;
+    for (int i = 0; i < 25; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        turmite.run(batch);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << turmite.getSteps() << " steps, " << batch / seconds * 1e-6 << " M steps/s\n";
+
+        turmite.render(window, palette);
+        window.show();
+        window.waitKey(1);
+    }
+
+    // unbounded grid: Langton's ant leaves any fixed grid on its highway, the view follows the visited cells
+    cf::Turmite ant = cf::Turmite::FromFile(CHAOS_FILE_PATH "Ant_0.ant");
+    cf::WindowRasterized antWindow(600, 600, "Langton's ant (unbounded)");
+    for (int i = 0; i < 25; ++i) {
+        ant.run(2000000);
+        ant.render(antWindow, palette);
+        antWindow.show();
+        antWindow.waitKey(1);
+    }
+    std::cout << "ant at " << ant.getX() << ", " << ant.getY() << ": " << ant.getGrid().getNumChunks() << " chunks, "
+              << ant.getGrid().getMemoryUsage() / (1 << 20) << " MiB\n";
+
+    // highway: whole periods are skipped, a trillion steps take as long as a few million
+    uint64_t period;
+    int64_t dx, dy;
+    ant.run(1000000000000ull - ant.getSteps());
+    if (ant.getHighway(period, dx, dy))
+        std::cout << "highway: period " << period << ", moves " << dx << ", " << dy << " per period, ant at "
+                  << ant.getX() << ", " << ant.getY() << " after " << ant.getSteps() << " steps\n";
+    ant.render(antWindow, palette, ant.getX() - 300, ant.getY() - 300, 600, 600);
+    antWindow.show();
+
+    window.waitKey();
+    return 0;
+}
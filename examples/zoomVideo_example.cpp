@@ -0,0 +1,31 @@
+#ifdef _WIN32
+// enable exception handling for windows
+// this requires 'int main(int, char**)' function definition
+// therefore 'int main()' is dissabled
+#define CFCG_EXCEPTION_HANDLING
+#endif
+
+#include "zoomVideo.h"
+
+#include <chrono>
+#include <iostream>
+
+int main(int, char**) {
+    cf::EscapeTime fractal;
+    fractal.setMaxIterations(5000);
+
+    // cyclic coloring (the palette repeats every 64 iterations), equalization differs between the strips
+    cf::ColorMap colorMap = cf::ColorMap::FromFile(std::string(CHAOS_FILE_PATH) + "Mandel.pal");
+    colorMap.setScaling(cf::ColorMap::Scaling::CYCLIC);
+    colorMap.setPeriod(64.f);
+
+    cf::ZoomVideo video(fractal, colorMap, {-0.743643887037151, 0.131825904205330});
+    video.setViewWidths(4.0, 1e-9);
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::size_t samples = video.render("zoom.avi", 1280, 720, 600, 30.0);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "600 frames in " << seconds << " s, " << samples << " samples (" << samples / 600 << " per frame)"
+              << std::endl;
+    return 0;
+}
@@ -0,0 +1,74 @@
+#ifndef BASIN_MAP_H_H
+#define BASIN_MAP_H_H
+
+#include "orbitEngine.h"
+#include "windowVectorized.h"
+
+namespace cf {
+
+/**
+ * @brief The BasinMap struct colors every starting point by the attractor its orbit ends on
+ *
+ * every pixel center is used as starting point, the pixels are processed tile wise by all hardware threads,
+ * all threads share one label per pixel: as soon as an orbit enters a pixel, which already has been labelled,
+ * the orbit gets the same label ("follow until known")
+ *
+ * periodic attractors are identified by their cycle (see cf::OrbitEngine), other attractors by the cells of a coarse
+ * grid (one pixel or the attractor tolerance) their last orbit points occupy, attractors touched by the same orbit are
+ * merged
+ */
+struct BasinMap {
+    static constexpr const int32_t DIVERGED = 0; /* label of escaping orbits, attractors start with label 1 */
+
+    struct Result {
+        int width = 0;
+        int height = 0;
+        std::vector<int32_t> labels; /* row major, row 0 is the top most row */
+        std::vector<std::vector<glm::dvec2>> attractors; /* sample points of attractor 'label - 1' */
+        std::size_t evaluations = 0;
+        std::size_t reusedLabels = 0; /* number of pixels, which have been labelled by an already labelled pixel */
+    };
+
+    BasinMap(const cf::OrbitMap& map);
+    BasinMap(const cf::Orbit& orbit);
+
+    /**
+     * @brief setIterations Maximum number of iterations per starting point
+     */
+    void setIterations(std::size_t maxIterations);
+
+    /**
+     * @brief setEscapeRadius Orbits with |x| or |y| above 'radius' are treated as diverging
+     */
+    void setEscapeRadius(double radius);
+
+    /**
+     * @brief setAttractorTolerance Cycle detection tolerance and maximum distance of points on the same attractor
+     */
+    void setAttractorTolerance(double tolerance);
+
+    /**
+     * @brief setLabelReuse Enables/disables the label reuse of already labelled pixels (enabled by default)
+     */
+    void setLabelReuse(bool reuse);
+    void setNumThreads(unsigned numThreads);
+
+    Result calculate(int width, int height, const cf::Interval& range_x, const cf::Interval& range_y) const;
+
+    /**
+     * @brief render Calculates the basins within the window intervals
+     * @param palette Color palette, diverging orbits use the first entry, attractor 'n' uses entry 1 + (n - 1) % (size - 1)
+     */
+    void render(cf::WindowVectorized& window, const std::vector<cf::Color>& palette) const;
+
+  private:
+    cf::OrbitMap m_Map;
+    std::size_t m_MaxIterations = 1000;
+    double m_EscapeRadius = 1e6;
+    double m_AttractorTolerance = 1e-6;
+    bool m_LabelReuse = true;
+    unsigned m_NumThreads = 0;
+};
+} // namespace cf
+
+#endif // BASIN_MAP_H_H
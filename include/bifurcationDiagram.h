@@ -0,0 +1,77 @@
+#ifndef BIFURCATION_DIAGRAM_H_H
+#define BIFURCATION_DIAGRAM_H_H
+
+#include "densityCanvas.h"
+#include "orbitEngine.h"
+
+namespace cf {
+
+/**
+ * @brief The BifurcationDiagram struct sweeps one factor of an orbit along the x axis
+ *
+ * every column uses its own factor value, skips the transient iterations and accumulates the remaining orbit points
+ * into a histogram of the column, the columns are distributed over all hardware threads
+ */
+struct BifurcationDiagram {
+    enum class Coordinate { X, Y };
+
+    /**
+     * @brief BifurcationDiagram Constructor
+     * @param orbit Orbit providing the factors and the starting point
+     * @param factorIndex Index of the factor to be swept (0 -> 'a', ... 9 -> 'j')
+     */
+    BifurcationDiagram(const cf::Orbit& orbit, std::size_t factorIndex);
+    BifurcationDiagram(const cf::OrbitMap& map, const glm::dvec2& startingPoint, std::size_t factorIndex);
+
+    /**
+     * @brief setIterations Sets the iteration budget per column
+     * @param transient Number of skipped iterations
+     * @param plotted Number of iterations to be accumulated
+     */
+    void setIterations(std::size_t transient, std::size_t plotted);
+
+    /**
+     * @brief setPlottedCoordinate Orbit coordinate displayed on the y axis
+     */
+    void setPlottedCoordinate(Coordinate coordinate);
+
+    /**
+     * @brief setCycleTolerance Columns collapsing onto a cycle stop iterating and weight the cycle points instead,
+     * a tolerance of 0 disables the cycle detection
+     */
+    void setCycleTolerance(double tolerance);
+
+    /**
+     * @brief setNumThreads Number of worker threads, 0 -> number of hardware threads
+     */
+    void setNumThreads(unsigned numThreads);
+
+    /**
+     * @brief calculate Calculates the diagram
+     * @param canvas Canvas to be filled, its x interval is the factor range, its y interval the coordinate range
+     */
+    void calculate(cf::DensityCanvas& canvas) const;
+
+    /**
+     * @brief render Calculates the diagram within the window intervals and writes the log density into the window,
+     * each column is normalized on its own
+     * @param palette Color palette, see cf::DensityCanvas::render
+     */
+    void render(cf::WindowVectorized& window, const std::vector<cf::Color>& palette = {}) const;
+
+  private:
+    void _calculateColumn(const cf::DensityCanvas& canvas, int col, std::vector<uint32_t>& histogram) const;
+
+    cf::OrbitMap m_Map;
+    glm::dvec2 m_StartingPoint;
+    std::size_t m_FactorIndex;
+
+    std::size_t m_TransientIterations = 1000;
+    std::size_t m_PlottedIterations = 10000;
+    Coordinate m_Coordinate = Coordinate::X;
+    double m_CycleTolerance = 1e-10;
+    unsigned m_NumThreads = 0;
+};
+} // namespace cf
+
+#endif // BIFURCATION_DIAGRAM_H_H
@@ -0,0 +1,233 @@
+#ifndef CELLULAR_AUTOMATON_H_H
+#define CELLULAR_AUTOMATON_H_H
+
+#include "windowRasterized.h"
+
+namespace cf {
+
+/**
+ * @brief ca Compile time rules of cf::CellularAutomaton
+ *
+ * a rule maps the state of a cell and the number of its 8 neighbours in state 1 (alive) to the next state: a dead cell
+ * (state 0) is born, if the count is in the birth set, an alive cell survives, if the count is in the survival set,
+ * otherwise it starts dying (Generations rules, state 2, 3, ... up to STATES - 1, then 0), with two states this are the
+ * outer totalistic life-like rules, e.g. B3/S23
+ */
+namespace ca {
+
+/**
+ * @brief counts Bitmask of neighbour counts (bit n -> n neighbours), e.g. counts(2, 3) for S23
+ */
+constexpr uint16_t counts() { return 0; }
+template <typename... _Counts> constexpr uint16_t counts(int count, _Counts... rest) {
+    return uint16_t(1 << count) | counts(rest...);
+}
+
+/**
+ * @brief _InSet 0xFF, if bit 'count' of 'SET' is set, otherwise 0 (one comparison per set bit, no table lookup)
+ */
+template <uint16_t SET, int N = 8> struct _InSet {
+    static uint8_t test(uint8_t count) {
+        return uint8_t(((SET >> N) & 1 ? uint8_t(-uint8_t(count == N)) : uint8_t(0)) | _InSet<SET, N - 1>::test(count));
+    }
+};
+template <uint16_t SET> struct _InSet<SET, -1> {
+    static uint8_t test(uint8_t) { return 0; }
+};
+
+/**
+ * @brief _Next Next state from the masks (0xFF/0) 'born' and 'survives', branch free on bytes
+ *
+ * dead: born -> 1, alive: survives -> 1, otherwise state + 1 (dying), the state after the last one is 0
+ */
+inline uint8_t _Next(uint8_t state, uint8_t born, uint8_t survives, int states) {
+    const uint8_t dead = uint8_t(-uint8_t(state == 0)), alive = uint8_t(-uint8_t(state == 1));
+    const uint8_t dying = uint8_t((state + 1) & -uint8_t(state + 1 != states));
+    const uint8_t one = uint8_t((dead & born) | (alive & survives));
+    return uint8_t((one & 1) | (~one & ~dead & dying));
+}
+
+/**
+ * @brief The StaticRule struct Rule B'BIRTH'/S'SURVIVAL'/C'STATES' as type, the sets are folded into the kernel
+ */
+template <uint16_t BIRTH, uint16_t SURVIVAL, int STATES = 2> struct StaticRule {
+    static_assert(BIRTH < 512 && SURVIVAL < 512, "neighbour counts have to be within [0, 8]");
+    static_assert(STATES >= 2 && STATES <= 256, "the number of states has to be within [2, 256]");
+    static constexpr const uint16_t birth = BIRTH;
+    static constexpr const uint16_t survival = SURVIVAL;
+    static constexpr const int states = STATES;
+
+    static uint8_t next(uint8_t state, uint8_t count) {
+        return _Next(state, _InSet<BIRTH>::test(count), _InSet<SURVIVAL>::test(count), STATES);
+    }
+};
+
+using Conway = StaticRule<counts(3), counts(2, 3)>;                        /* B3/S23 */
+using HighLife = StaticRule<counts(3, 6), counts(2, 3)>;                   /* B36/S23 */
+using DayAndNight = StaticRule<counts(3, 6, 7, 8), counts(3, 4, 6, 7, 8)>; /* B3678/S34678 */
+using Seeds = StaticRule<counts(2), counts()>;                             /* B2/S */
+using BriansBrain = StaticRule<counts(2), counts(), 3>;                    /* B2/S/C3 */
+using StarWars = StaticRule<counts(2), counts(3, 4, 5), 4>;                /* B2/S345/C4 */
+} // namespace ca
+
+/**
+ * @brief The CellularAutomaton struct Life-like and Generations cellular automata (one byte per cell)
+ *
+ * a generation works row by row: the alive cells of three rows are summed up per column, three neighbouring column
+ * sums are the count of the 3 x 3 block and the next state is a function of the count and the state, both loops are
+ * vectorized by the compiler, stripes of rows are distributed over threads (double buffered)
+ *
+ * rules: the rule of a kernel is a template parameter (see cf::ca), rule strings are parsed at run time and dispatched
+ * to the pre-instantiated kernels of cf::ca (Conway, HighLife, Day & Night, Seeds, Brian's Brain, Star Wars), all other
+ * rules use a generic kernel, which reads the sets at run time, the kernel is selected once per rule, not per cell
+ *
+ * topology: the cells outside of the grid are dead (PLANE) or the grid wraps around (TORUS)
+ */
+struct CellularAutomaton {
+    enum class Topology { PLANE, TORUS };
+
+    /**
+     * @brief The Rule struct Rule at run time, 'birth'/'survival' are bitmasks of neighbour counts (see ca::counts)
+     */
+    struct Rule {
+        uint16_t birth = ca::counts(3);
+        uint16_t survival = ca::counts(2, 3);
+        int states = 2;
+
+        /**
+         * @brief Parse Reads a rule string: "B3/S23", "B36S23", "B2/S/C3" (Generations), or the S/B notation "23/3"
+         * and "345/2/4" (survival/birth/states)
+         */
+        static Rule Parse(const std::string& rule);
+
+        /**
+         * @brief toString B/S notation, e.g. "B3/S23" or "B2/S345/C4"
+         */
+        std::string toString() const;
+
+        uint8_t next(uint8_t state, uint8_t count) const {
+            return ca::_Next(state, uint8_t(-((this->birth >> count) & 1)), uint8_t(-((this->survival >> count) & 1)),
+                             this->states);
+        }
+
+        bool operator==(const Rule& other) const {
+            return this->birth == other.birth && this->survival == other.survival && this->states == other.states;
+        }
+        bool operator!=(const Rule& other) const { return !(*this == other); }
+    };
+
+    CellularAutomaton(int width, int height, const std::string& rule = "B3/S23", Topology topology = Topology::TORUS);
+
+    /**
+     * @brief FromDATFile Reads a pattern of a .dat file (e.g. Life2.dat, see cf::readDATFile), the pattern is centered
+     */
+    static CellularAutomaton FromDATFile(const std::string& filePath, int width, int height,
+                                         const std::string& rule = "B3/S23", Topology topology = Topology::TORUS);
+
+    /**
+     * @brief setRule Parses 'rule' (see Rule::Parse), cells in states beyond the new number of states die
+     */
+    void setRule(const std::string& rule);
+    void setRule(const Rule& rule);
+
+    /**
+     * @brief setRule Uses the kernel of the compile time rule '_Rule' (any ca::StaticRule)
+     */
+    template <typename _Rule> void setRule() {
+        this->_setRule({_Rule::birth, _Rule::survival, _Rule::states}, &CellularAutomaton::_CompiledRow<_Rule>, true);
+    }
+
+    const Rule& getRule() const;
+
+    /**
+     * @brief hasCompiledKernel True, if the rule has a pre-instantiated kernel (false -> generic kernel)
+     */
+    bool hasCompiledKernel() const;
+
+    /**
+     * @brief load Sets the cells of 'points' (x, y, state), the pattern is moved by 'offsetX'/'offsetY'
+     */
+    void load(const std::vector<glm::vec3>& points, int offsetX = 0, int offsetY = 0);
+
+    /**
+     * @brief randomize Random soup, every cell is alive (state 1) with the probability 'density'
+     */
+    void randomize(double density, uint32_t seed);
+
+    uint8_t get(int x, int y) const;
+    void set(int x, int y, uint8_t state);
+    void clear();
+
+    /**
+     * @brief step Computes 'generations' further generations
+     */
+    void step(uint64_t generations = 1);
+
+    void setNumThreads(unsigned numThreads);
+
+    uint64_t getGeneration() const;
+
+    /**
+     * @brief getPopulation Number of cells with a state != 0 (alive and dying)
+     */
+    uint64_t getPopulation() const;
+    int getWidth() const;
+    int getHeight() const;
+    Topology getTopology() const;
+
+    /**
+     * @brief getCells States of all cells (row major)
+     */
+    const std::vector<uint8_t>& getCells() const;
+
+    /**
+     * @brief render Draws the whole grid scaled to the image (nearest neighbour), dying states fade from 'alive' to
+     * 'dead'
+     */
+    void render(cv::Mat& image, const cf::Color& alive = cf::Color::WHITE, const cf::Color& dead = cf::Color::BLACK) const;
+    void render(cf::WindowRasterized& window, const cf::Color& alive = cf::Color::WHITE,
+                const cf::Color& dead = cf::Color::BLACK) const;
+
+  private:
+    /**
+     * @brief _RowFunction Computes the next generation 'out' of 'row', 'sums' holds width + 2 bytes
+     */
+    using _RowFunction = void (*)(const Rule& rule, const uint8_t* north, const uint8_t* row, const uint8_t* south,
+                                  uint8_t* out, uint8_t* sums, int width, bool torus);
+
+    template <typename _Rule>
+    static void _Row(const _Rule& rule, const uint8_t* north, const uint8_t* row, const uint8_t* south, uint8_t* out,
+                     uint8_t* sums, int width, bool torus) {
+        // sums[x + 1]: alive cells of the column x within the three rows, sums[0]/sums[width + 1] are beyond the edges
+        for (int x = 0; x < width; ++x) // vectorized
+            sums[x + 1] = uint8_t(uint8_t(north[x] == 1) + uint8_t(row[x] == 1) + uint8_t(south[x] == 1));
+        sums[0] = torus ? sums[width] : uint8_t(0);
+        sums[width + 1] = torus ? sums[1] : uint8_t(0);
+        for (int x = 0; x < width; ++x) { // vectorized
+            const uint8_t count = uint8_t(uint8_t(sums[x] + sums[x + 1]) + uint8_t(sums[x + 2] - uint8_t(row[x] == 1)));
+            out[x] = rule.next(row[x], count);
+        }
+    }
+
+    template <typename _Rule>
+    static void _CompiledRow(const Rule&, const uint8_t* north, const uint8_t* row, const uint8_t* south, uint8_t* out,
+                             uint8_t* sums, int width, bool torus) {
+        _Row(_Rule(), north, row, south, out, sums, width, torus);
+    }
+
+    void _setRule(const Rule& rule, _RowFunction row, bool compiled);
+
+    int m_Width;
+    int m_Height;
+    Topology m_Topology;
+    Rule m_Rule;
+    _RowFunction m_Row = nullptr;
+    bool m_Compiled = false;
+    std::vector<uint8_t> m_Cells;
+    std::vector<uint8_t> m_Next;
+    uint64_t m_Generation = 0;
+    unsigned m_NumThreads = 0;
+};
+} // namespace cf
+
+#endif // CELLULAR_AUTOMATON_H_H
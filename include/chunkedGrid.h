@@ -0,0 +1,115 @@
+#ifndef CHUNKED_GRID_H_H
+#define CHUNKED_GRID_H_H
+
+#include "windowRasterized.h"
+
+#include <memory>
+
+namespace cf {
+
+/**
+ * @brief The ChunkedGrid struct Unbounded grid of byte cells (e.g. states of turmites or cellular automata)
+ *
+ * the plane is split into square chunks of CHUNK_SIZE x CHUNK_SIZE cells, which are allocated on first write, cells of
+ * unallocated chunks are 0, memory is proportional to the touched area
+ *
+ * - chunks come from a pool (blocks of chunks, clear() keeps the blocks for reuse)
+ * - the chunk directory is an open addressing hash table (linear probing) of chunk coordinates
+ * - getChunk caches the last chunk (a turmite mostly stays within one chunk for many steps)
+ */
+struct ChunkedGrid {
+    static constexpr const int CHUNK_BITS = 6;
+    static constexpr const int CHUNK_SIZE = 1 << CHUNK_BITS;
+    static constexpr const int CHUNK_CELLS = CHUNK_SIZE * CHUNK_SIZE;
+
+    struct Chunk {
+        int64_t x; /* chunk coordinates, the cell (x, y) belongs to the chunk (x >> CHUNK_BITS, y >> CHUNK_BITS) */
+        int64_t y;
+        uint8_t cells[CHUNK_CELLS]; /* row major */
+    };
+
+    ChunkedGrid();
+    ChunkedGrid(const ChunkedGrid& other);
+    ChunkedGrid(ChunkedGrid&& other);
+    ChunkedGrid& operator=(ChunkedGrid other);
+
+    static int64_t ChunkCoordinate(int64_t cell) { return cell >> CHUNK_BITS; } // floor division for negative cells
+    static int LocalCoordinate(int64_t cell) { return int(cell & (CHUNK_SIZE - 1)); }
+
+    /**
+     * @brief get State of a cell, 0 for cells of unallocated chunks (does not allocate)
+     */
+    uint8_t get(int64_t x, int64_t y) const {
+        const Chunk* chunk = this->findChunk(ChunkCoordinate(x), ChunkCoordinate(y));
+        return chunk ? chunk->cells[LocalCoordinate(y) * CHUNK_SIZE + LocalCoordinate(x)] : 0;
+    }
+    void set(int64_t x, int64_t y, uint8_t state) {
+        Chunk& chunk = this->getChunk(ChunkCoordinate(x), ChunkCoordinate(y));
+        chunk.cells[LocalCoordinate(y) * CHUNK_SIZE + LocalCoordinate(x)] = state;
+    }
+
+    /**
+     * @brief getChunk Chunk with the chunk coordinates 'chunkX'/'chunkY', allocated on demand (references stay valid
+     * until clear() is called)
+     */
+    Chunk& getChunk(int64_t chunkX, int64_t chunkY) {
+        if (this->m_Hot && this->m_Hot->x == chunkX && this->m_Hot->y == chunkY)
+            return *this->m_Hot;
+        this->m_Hot = &this->_findOrAllocate(chunkX, chunkY);
+        return *this->m_Hot;
+    }
+
+    /**
+     * @brief findChunk Chunk with the chunk coordinates 'chunkX'/'chunkY', nullptr if not allocated
+     */
+    const Chunk* findChunk(int64_t chunkX, int64_t chunkY) const;
+
+    /**
+     * @brief getChunks All allocated chunks (allocation order)
+     */
+    const std::vector<Chunk*>& getChunks() const;
+
+    /**
+     * @brief getBounds Bounding box of all cells with a state != 0 (inclusive)
+     * @return False, if all cells are 0
+     */
+    bool getBounds(int64_t& minX, int64_t& minY, int64_t& maxX, int64_t& maxY) const;
+
+    std::size_t getNumChunks() const;
+
+    /**
+     * @brief getMemoryUsage Bytes of the chunk pool and the directory
+     */
+    std::size_t getMemoryUsage() const;
+
+    /**
+     * @brief clear Sets all cells to 0 (the chunks return to the pool)
+     */
+    void clear();
+
+    /**
+     * @brief render Draws the region of 'columns' x 'rows' cells starting at the cell 'minX'/'minY' (top left) scaled to
+     * the whole image (nearest neighbour), the cells use the palette entry of their state (e.g. Chaos_ant.pal)
+     */
+    void render(cv::Mat& image, const std::vector<cf::Color>& palette, int64_t minX, int64_t minY, int64_t columns,
+                int64_t rows) const;
+    void render(cf::Window2D& window, const std::vector<cf::Color>& palette, int64_t minX, int64_t minY, int64_t columns,
+                int64_t rows) const;
+    void render(cf::WindowRasterized& window, const std::vector<cf::Color>& palette, int64_t minX, int64_t minY,
+                int64_t columns, int64_t rows) const;
+
+  private:
+    static constexpr const std::size_t POOL_BLOCK = 64; // chunks per pool block
+
+    Chunk& _findOrAllocate(int64_t chunkX, int64_t chunkY);
+    std::size_t _slot(int64_t chunkX, int64_t chunkY) const;
+    void _grow();
+
+    std::vector<std::unique_ptr<Chunk[]>> m_Pool;
+    std::vector<Chunk*> m_Chunks;    /* allocated chunks, m_Chunks.size() of the pool are in use */
+    std::vector<Chunk*> m_Directory; /* hash table, nullptr -> empty slot, power of two size */
+    Chunk* m_Hot = nullptr;
+};
+} // namespace cf
+
+#endif // CHUNKED_GRID_H_H
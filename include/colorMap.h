@@ -0,0 +1,74 @@
+#ifndef COLOR_MAP_H_H
+#define COLOR_MAP_H_H
+
+#include "escapeTime.h"
+
+namespace cf {
+
+/**
+ * @brief The ColorMap struct colors escape time results with continuous (smooth) iteration counts
+ *
+ * the smooth iteration count of an escaped pixel is nu = n - log2(ln|z_n| / ln(radius)) (continuous across the escape
+ * time bands), it is scaled onto a position within the palette, colors are interpolated between neighbouring palette
+ * entries
+ *
+ * the histogram equalization distributes all escaped pixels evenly over the palette: every thread counts its rows
+ * into its own histogram, the merged histograms are turned into a cumulative distribution by a prefix sum
+ */
+struct ColorMap {
+    enum class Scaling {
+        CYCLIC,   /* the palette repeats every 'period' iterations */
+        EQUALIZED /* histogram equalization, the palette spans all escaped pixels once */
+    };
+
+    /**
+     * @brief ColorMap Constructor
+     * @param palette Color palette (e.g. from cf::readPaletteFromFile)
+     * @param insideColor Color of pixels, which did not escape
+     */
+    ColorMap(const std::vector<cf::Color>& palette, const cf::Color& insideColor = cf::Color::BLACK);
+
+    /**
+     * @brief FromFile Color map of a *.pal file (e.g. Mandel.pal)
+     */
+    static ColorMap FromFile(const std::string& filePath, const cf::Color& insideColor = cf::Color::BLACK);
+
+    void setScaling(Scaling scaling);
+
+    /**
+     * @brief setPeriod Iterations per palette cycle of the scaling CYCLIC (default: palette size, one entry per iteration)
+     */
+    void setPeriod(float iterations);
+    void setNumThreads(unsigned numThreads);
+
+    /**
+     * @brief SmoothIterations Continuous iteration counts nu = n - log2(ln|z_n| / ln(radius)) of all pixels within
+     * [n - 1, n) (-1 -> inside)
+     * @param numThreads Number of threads (0 -> all hardware threads)
+     */
+    static std::vector<float> SmoothIterations(const cf::EscapeTime::Result& result, unsigned numThreads = 0);
+
+    /**
+     * @brief calculatePositions Palette positions of all pixels within [0, palette size) (-1 -> inside)
+     */
+    std::vector<float> calculatePositions(const cf::EscapeTime::Result& result) const;
+
+    /**
+     * @brief apply Writes the colors of all pixels into a BGR image of the same size as the result
+     */
+    void apply(const cf::EscapeTime::Result& result, cv::Mat& image) const;
+    void render(const cf::EscapeTime::Result& result, cf::WindowVectorized& window) const;
+
+  private:
+    // palette channels as separate arrays (vectorized interpolation)
+    std::vector<float> m_Red;
+    std::vector<float> m_Green;
+    std::vector<float> m_Blue;
+    cf::Color m_InsideColor;
+    Scaling m_Scaling = Scaling::CYCLIC;
+    float m_Period;
+    unsigned m_NumThreads = 0;
+};
+} // namespace cf
+
+#endif // COLOR_MAP_H_H
@@ -1,6 +1,7 @@
 #ifndef COMPUTER_GEOMETRY_H_H
 #define COMPUTER_GEOMETRY_H_H
 
+#include "multiPrecision.hpp"
 #include "utils.h"
 #include "windowCoordinateSystem.h"
 #include <fstream>
@@ -25,6 +26,12 @@ typedef Vec3<false, float> DirectionVector_f;
 
 typedef Vec3<true, long double> PointVector_ld;
 typedef Vec3<false, long double> DirectionVector_ld;
+
+typedef Vec3<true, cf::DoubleDouble> PointVector_dd;
+typedef Vec3<false, cf::DoubleDouble> DirectionVector_dd;
+
+typedef Vec3<true, cf::QuadDouble> PointVector_qd;
+typedef Vec3<false, cf::QuadDouble> DirectionVector_qd;
 #endif
 
 /**
@@ -297,7 +304,7 @@ template <bool IS_POINTVECTOR, typename _ValueType> class Vec3 {
             cf::Console::printWarning("Normalizing point vector with w = 0  -> point at infinity");
             return {std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()};
         }
-        if (!self_type::_EqualZero(std::abs(this->m_Data.z - _ValueType(1.0))))
+        if (!self_type::_EqualZero(this->m_Data.z - _ValueType(1.0)))
             cf::Console::printWarning("Applying temporary normalization to point vector (you may want to do this yourself)!\n");
         return cf::Point(this->m_Data.x / this->m_Data.z, this->m_Data.y / this->m_Data.z);
     }
@@ -348,7 +355,8 @@ template <bool IS_POINTVECTOR, typename _ValueType> class Vec3 {
             throw std::runtime_error(MSG);
 #endif
 #undef MSG
-        return std::sqrt(this->m_Data[0] * this->m_Data[0] + this->m_Data[1] * this->m_Data[1]);
+        using std::sqrt; // cf::DoubleDouble and cf::QuadDouble are found by argument dependent lookup
+        return sqrt(this->m_Data[0] * this->m_Data[0] + this->m_Data[1] * this->m_Data[1]);
     }
 
     /**
@@ -402,7 +410,10 @@ template <bool IS_POINTVECTOR, typename _ValueType> class Vec3 {
 
     template <bool b, typename _VType> friend std::ostream&(::operator<<)(std::ostream&, const Vec3<b, _VType>&);
 
-    template <typename _VType> static bool _EqualZero(const _VType& v) { return std::abs(v) < _ValueType(0.000001); }
+    template <typename _VType> static bool _EqualZero(const _VType& v) {
+        using std::abs;
+        return abs(v) < _ValueType(0.000001);
+    }
 
     glmVec3 m_Data;
 };
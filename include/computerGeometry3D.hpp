@@ -2,6 +2,7 @@
 #define COMPUTER_GEOMETRY_H_H
 
 #pragma once
+#include "multiPrecision.hpp"
 #include "utils.h"
 #include <algorithm>
 #include <type_traits>
@@ -11,6 +12,8 @@ namespace cf {
 // declarations
 template <typename _VType> struct MultiVector;
 typedef MultiVector<long double> ldMultiVector;
+typedef MultiVector<cf::QuadDouble> qdMultiVector;
+typedef MultiVector<cf::DoubleDouble> ddMultiVector;
 typedef MultiVector<double> dMultiVector;
 typedef MultiVector<float> fMultiVector;
 typedef MultiVector<double> Vec;
@@ -64,7 +67,8 @@ template <typename _ValueType> struct MultiVector {
         std::vector<TYPE> outerProduct;
 
         bool operator==(const Blade& rhs) const {
-            return this->type == rhs.type && std::abs(this->factor - rhs.factor) < _ValueType(0.00001) &&
+            using std::abs;
+            return this->type == rhs.type && abs(this->factor - rhs.factor) < _ValueType(0.00001) &&
                    this->outerProduct == rhs.outerProduct;
         }
 
@@ -555,7 +559,10 @@ template <typename _ValueType> struct MultiVector {
             this->m_Data.emplace_back(Blade::TYPE::VALUE, 0.0);
     }
 
-    template <typename T> static bool _CmpZero(const T& value) { return std::abs(value) < T(0.000001); }
+    template <typename T> static bool _CmpZero(const T& value) {
+        using std::abs;
+        return abs(value) < T(0.000001);
+    }
 
     std::vector<Blade> m_Data;
 };
@@ -0,0 +1,92 @@
+#ifndef DEEP_ZOOM_H_H
+#define DEEP_ZOOM_H_H
+
+#include "escapeTime.h"
+#include "fixedPoint.h"
+
+namespace cf {
+
+/**
+ * @brief The DeepZoom struct renders the Mandelbrot set at zoom levels beyond double precision (perturbation theory)
+ *
+ * one reference orbit Z_n is calculated at the view center with cf::FixedPoint precision, every pixel c = C + dc
+ * only iterates its difference d_n = z_n - Z_n in double precision: d' = (2 * Z_n + d) * d + dc
+ *
+ * glitches (the pixel orbit gets closer to zero than to the reference, d loses all precision) are detected by
+ * |Z_n + d_n| < |d_n|, glitched pixels are rebased onto the start of the reference orbit (d = Z_n + d_n, n = 0),
+ * the same rebasing is used, if the reference orbit escapes before the pixel orbit
+ *
+ * the first iterations are skipped by a series approximation shared by all pixels:
+ * d_n = a_1,n * dc + a_2,n * dc^2 + ... + a_k,n * dc^k (one complex polynomial in dc, evaluated at dc / radius),
+ * the coefficients follow the reference orbit until the approximation deviates from probe pixels at the view border
+ *
+ * zoom levels are limited by the double exponent range (view widths down to about 1e-290)
+ */
+struct DeepZoom {
+    struct Result : cf::EscapeTime::Result {
+        std::size_t referenceLength = 0; /* number of iterations of the reference orbit */
+        std::size_t rebases = 0;         /* number of detected glitches/rebases of all pixels */
+        uint32_t skippedIterations = 0;  /* iterations skipped by the series approximation ('evaluations' excludes them) */
+    };
+
+    /**
+     * @brief DeepZoom Constructor
+     * @param centerReal Real part of the view center as decimal string (e.g. "-0.7436438870371587047521915")
+     * @param centerImag Imaginary part of the view center
+     * @param viewWidth Width of the view in the complex plane (the height follows from the image aspect ratio)
+     */
+    DeepZoom(const std::string& centerReal, const std::string& centerImag, double viewWidth);
+
+    void setMaxIterations(uint32_t maxIterations);
+    void setEscapeRadius(double radius);
+    void setNumThreads(unsigned numThreads);
+
+    /**
+     * @brief setSeriesApproximation Configures the series approximation
+     * @param terms Number of polynomial terms (0 disables the approximation, otherwise 2 - 16, default 4)
+     * @param tolerance Maximum relative deviation of the probe pixels (default 1e-6)
+     */
+    void setSeriesApproximation(unsigned terms, double tolerance = 1e-6);
+
+    /**
+     * @brief setViewWidth Zooms in or out, the reference orbit precision follows the view width
+     */
+    void setViewWidth(double viewWidth);
+
+    Result calculate(int width, int height) const;
+
+    /**
+     * @brief render Calculates the view with the size of the window (the window intervals are ignored)
+     * @param palette Color palette (e.g. Mandel.pal), escaped pixels use the entry 'iterations % size'
+     */
+    void render(cf::WindowVectorized& window, const std::vector<cf::Color>& palette,
+                const cf::Color& insideColor = cf::Color::BLACK) const;
+
+    /**
+     * @brief calculateReferenceOrbit Calculates the reference orbit at the view center (Z_0 = 0 until escape or the
+     * maximum number of iterations), the orbit is returned as double precision values
+     */
+    std::vector<std::complex<double>> calculateReferenceOrbit() const;
+
+  private:
+    int _fractionBits() const;
+
+    /**
+     * @brief _seriesApproximation Calculates the number of skippable iterations and the scaled coefficients
+     * a_k,n * radius^k of the last valid iteration
+     */
+    uint32_t _seriesApproximation(const std::vector<std::complex<double>>& reference, double radius, int width, int height,
+                                  std::vector<std::complex<double>>& coefficients) const;
+
+    std::string m_CenterReal;
+    std::string m_CenterImag;
+    double m_ViewWidth;
+    uint32_t m_MaxIterations = 1000;
+    double m_EscapeRadius = 2.0;
+    unsigned m_NumThreads = 0;
+    unsigned m_SeriesTerms = 4;
+    double m_SeriesTolerance = 1e-6;
+};
+} // namespace cf
+
+#endif // DEEP_ZOOM_H_H
@@ -0,0 +1,75 @@
+#ifndef DENSITY_CANVAS_H_H
+#define DENSITY_CANVAS_H_H
+
+#include "windowVectorized.h"
+
+namespace cf {
+
+/**
+ * @brief The DensityCanvas struct counts hits per pixel (e.g. of orbit points) and converts them into an image
+ *
+ * row 0 is the top most row (same as the image), the y interval is displayed bottom up (same as cf::WindowVectorized)
+ */
+struct DensityCanvas {
+    enum class Normalization { GLOBAL /* one maximum for the whole canvas */, PER_COLUMN /* maximum per column */ };
+
+    DensityCanvas(int width = 1, int height = 1, const cf::Interval& range_x = {0.f, 1.f},
+                  const cf::Interval& range_y = {0.f, 1.f});
+
+    /**
+     * @brief DensityCanvas Canvas matching the size and intervals of a window
+     */
+    DensityCanvas(cf::WindowVectorized& window);
+
+    void clear();
+
+    /**
+     * @brief addPoint Adds a hit at interval position x/y, points outside of the intervals will be ignored
+     */
+    void addPoint(double x, double y, uint32_t weight = 1) {
+        const double col = (x - this->m_RangeX.min) * this->m_ScaleX;
+        const double row = (this->m_RangeY.max - y) * this->m_ScaleY;
+        if (col >= 0.0 && row >= 0.0 && col < this->m_Width && row < this->m_Height)
+            this->m_Data[std::size_t(row) * this->m_Width + std::size_t(col)] += weight;
+    }
+    void addPixel(int col, int row, uint32_t weight = 1) { this->m_Data[std::size_t(row) * this->m_Width + col] += weight; }
+
+    uint32_t getCount(int col, int row) const { return this->m_Data[std::size_t(row) * this->m_Width + col]; }
+    uint32_t* getRow(int row) { return &this->m_Data[std::size_t(row) * this->m_Width]; }
+    const uint32_t* getRow(int row) const { return &this->m_Data[std::size_t(row) * this->m_Width]; }
+
+    int getWidth() const;
+    int getHeight() const;
+    const cf::Interval& getRangeX() const;
+    const cf::Interval& getRangeY() const;
+
+    /**
+     * @brief getLevels Logarithmic density of every pixel (row major) within [1, maxLevel], 0 for empty pixels
+     * @param maxLevel Level of the maximum count
+     * @param normalization Use one global maximum or normalize every column on its own
+     */
+    std::vector<int> getLevels(int maxLevel, Normalization normalization = Normalization::GLOBAL) const;
+
+    /**
+     * @brief render Writes the logarithmic density into the window image
+     * @param window Window of the same size as the canvas
+     * @param palette Color palette (e.g. from cf::readPaletteFromFile), first entry is used for empty pixels,
+     * an empty palette results in a grey scale image
+     * @param normalization Use one global maximum or normalize every column on its own
+     */
+    void render(cf::WindowVectorized& window, const std::vector<cf::Color>& palette = {},
+                Normalization normalization = Normalization::GLOBAL) const;
+
+  private:
+    int m_Width;
+    int m_Height;
+    cf::Interval m_RangeX;
+    cf::Interval m_RangeY;
+    double m_ScaleX;
+    double m_ScaleY;
+
+    std::vector<uint32_t> m_Data;
+};
+} // namespace cf
+
+#endif // DENSITY_CANVAS_H_H
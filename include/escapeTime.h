@@ -0,0 +1,165 @@
+#ifndef ESCAPE_TIME_H_H
+#define ESCAPE_TIME_H_H
+
+#include "multiPrecision.hpp"
+#include "windowVectorized.h"
+
+#include <complex>
+
+namespace cf {
+
+/**
+ * @brief The EscapeTime struct calculates escape time fractals (Mandelbrot and Julia sets) z' = z^2 + c
+ *
+ * every pixel center is mapped onto the complex plane by the window intervals (x -> real, y -> imaginary part),
+ * the image is split into tiles, which are distributed over all hardware threads (dynamic scheduling),
+ * within a tile neighbouring pixels are iterated together in lane groups of 'LANES' pixels,
+ * escaped lanes are masked out (their values freeze) until all lanes of the group escaped
+ *
+ * the modes MARIANI_SILVER and BOUNDARY_TRACING only iterate a subset of the pixels of every tile and fill regions
+ * enclosed by pixels of equal iteration count (exact for connected level sets like the Mandelbrot set and its
+ * escape time bands, details smaller than the sampled borders may be missed), filled pixels copy the norm as well
+ *
+ * interior pixels are detected early (see setInteriorDetection), their norm is the one of the last iterated value
+ *
+ * the precisions DOUBLE_DOUBLE and QUAD_DOUBLE iterate z and c with cf::DoubleDouble or cf::QuadDouble (the escape and
+ * periodicity checks and the derivative only require double), rounding errors grow with the number of iterations:
+ * view widths down to about 1e-18 or 1e-40 are resolved (at 20000 iterations) without a reference orbit
+ */
+struct EscapeTime {
+    static constexpr const int LANES = 16;
+
+    enum class Mode {
+        FULL,             /* every pixel is iterated */
+        MARIANI_SILVER,   /* recursive subdivision of the tiles, rectangles with uniform borders are filled */
+        BOUNDARY_TRACING, /* only the borders between regions of different iteration counts are traced and filled */
+    };
+
+    enum class Precision {
+        DOUBLE,        /* 53 bit mantissa */
+        DOUBLE_DOUBLE, /* 106 bit mantissa (cf::DoubleDouble), about an order of magnitude slower */
+        QUAD_DOUBLE,   /* 212 bit mantissa (cf::QuadDouble) */
+    };
+
+    struct Result {
+        int width = 0;
+        int height = 0;
+        uint32_t maxIterations = 0;
+        double escapeRadius = 0.0;        /* escape radius of the calculation (e.g. for smooth coloring) */
+        std::vector<uint32_t> iterations; /* row major, row 0 is the top most row, 'maxIterations' -> inside */
+        std::vector<double> norms;        /* |z|^2 after the last iteration (e.g. for smooth coloring) */
+        std::vector<float> distances;     /* exterior distance estimates, 0 -> inside (only with distance estimation) */
+        std::size_t evaluations = 0;      /* sum of the iterations of all iterated pixels */
+        std::size_t computedPixels = 0;   /* number of iterated pixels, the others were filled (see Mode) */
+
+        bool isInside(std::size_t idx) const { return this->iterations[idx] >= this->maxIterations; }
+    };
+
+    /**
+     * @brief EscapeTime Mandelbrot set: z_0 = 0, c = pixel
+     */
+    EscapeTime();
+
+    /**
+     * @brief Julia Julia set: z_0 = pixel, c = 'c'
+     */
+    static EscapeTime Julia(const std::complex<double>& c);
+
+    void setMaxIterations(uint32_t maxIterations);
+    uint32_t getMaxIterations() const;
+
+    /**
+     * @brief setEscapeRadius Orbits with |z| > radius are treated as escaped (default 2, maximum 1e50, larger radii result
+     * in smoother colorings)
+     */
+    void setEscapeRadius(double radius);
+    double getEscapeRadius() const;
+    void setNumThreads(unsigned numThreads);
+    void setMode(Mode mode);
+    void setPrecision(Precision precision);
+
+    /**
+     * @brief setInteriorDetection Enables the early detection of interior pixels (default enabled):
+     * the analytic main cardioid and period-2 bulb tests (Mandelbrot set only) and the periodicity check,
+     * which declares a pixel interior as soon as its orbit returns to a previously saved value
+     * @param periodicityTolerance Maximum distance of a repeated orbit value (0 disables the periodicity check)
+     */
+    void setInteriorDetection(bool enabled, double periodicityTolerance = 1e-12);
+
+    /**
+     * @brief setDistanceEstimation Enables the derivative tracking dz' = 2 * z * dz (+ 1 for the Mandelbrot set) and the
+     * exterior distance estimate |z| * ln|z| / |dz| of every escaped pixel (large escape radii improve the estimate),
+     * with Mariani-Silver or boundary tracing only interior regions are filled
+     */
+    void setDistanceEstimation(bool enabled);
+
+    Result calculate(int width, int height, const cf::Interval& range_x, const cf::Interval& range_y) const;
+
+    /**
+     * @brief calculate Calculates a view of the width 'viewWidth' (square pixels) around a center of higher precision
+     * than the window intervals, the pixel coordinates are rounded to the precision of the calculation (see setPrecision)
+     */
+    Result calculate(int width, int height, const cf::QuadDouble& centerReal, const cf::QuadDouble& centerImag,
+                     double viewWidth) const;
+
+    /**
+     * @brief calculate Calculates arbitrary points of the complex plane (the result has the size points.size() x 1)
+     */
+    Result calculate(const std::vector<std::complex<double>>& points) const;
+
+    /**
+     * @brief render Calculates the fractal within the window intervals
+     * @param palette Color palette (e.g. Mandel.pal), escaped pixels use the entry 'iterations % size'
+     * @param insideColor Color of pixels, which did not escape
+     */
+    void render(cf::WindowVectorized& window, const std::vector<cf::Color>& palette,
+                const cf::Color& insideColor = cf::Color::BLACK) const;
+
+    /**
+     * @brief render Colors an already calculated result of the same size as the window (see above)
+     */
+    static void render(const Result& result, cf::WindowVectorized& window, const std::vector<cf::Color>& palette,
+                       const cf::Color& insideColor = cf::Color::BLACK);
+
+    /**
+     * @brief renderDistance Colors a result with distance estimates: pixels within 'thickness' pixels of the boundary and
+     * inside pixels use 'boundaryColor', the color fades into 'exteriorColor' with growing distance
+     */
+    static void renderDistance(const Result& result, cf::WindowVectorized& window,
+                               const cf::Color& boundaryColor = cf::Color::BLACK,
+                               const cf::Color& exteriorColor = cf::Color::WHITE, double thickness = 1.0);
+
+  private:
+    struct _Lanes {
+        uint32_t iterations[LANES];
+        uint32_t evaluations[LANES]; /* actually performed iterations (smaller than 'iterations' for detected interior) */
+        double norms[LANES];
+        float distances[LANES]; /* only with distance estimation */
+    };
+
+    /**
+     * @brief _calculate Calculates the pixel centers minX + (col + 0.5) * stepX, maxY - (row + 0.5) * stepY
+     */
+    template <typename _Real>
+    Result _calculate(int width, int height, const _Real& minX, const _Real& maxY, double stepX, double stepY) const;
+
+    /**
+     * @brief _calculateLanes Iterates 'LANES' pixels
+     */
+    template <typename _Real> void _calculateLanes(const _Real* x, const _Real* y, _Lanes& lanes) const;
+    template <typename _Real, bool DERIVATIVE> void _iterateLanes(const _Real* x, const _Real* y, _Lanes& lanes) const;
+
+    bool m_Julia = false;
+    std::complex<double> m_JuliaC;
+    uint32_t m_MaxIterations = 256;
+    double m_EscapeRadius = 2.0;
+    unsigned m_NumThreads = 0;
+    Mode m_Mode = Mode::FULL;
+    Precision m_Precision = Precision::DOUBLE;
+    bool m_InteriorDetection = true;
+    double m_PeriodicityTolerance = 1e-12;
+    bool m_DistanceEstimation = false;
+};
+} // namespace cf
+
+#endif // ESCAPE_TIME_H_H
@@ -0,0 +1,50 @@
+#ifndef FIXED_POINT_H_H
+#define FIXED_POINT_H_H
+
+#include "BigIntegerLibrary.hh"
+
+#include <string>
+
+namespace cf {
+
+/**
+ * @brief The FixedPoint struct arbitrary precision fixed point number: value = mantissa * 2^-fractionBits
+ *
+ * the mantissa is a BigInteger, all operands of an operation require the same number of fraction bits,
+ * products are truncated towards zero
+ */
+struct FixedPoint {
+    FixedPoint(int fractionBits = 64);
+    FixedPoint(double value, int fractionBits);
+
+    /**
+     * @brief FromString Parses a decimal number like "-0.743643887037158704752191506114774"
+     */
+    static FixedPoint FromString(const std::string& decimal, int fractionBits);
+
+    FixedPoint operator+(const FixedPoint& other) const;
+    FixedPoint operator-(const FixedPoint& other) const;
+    FixedPoint operator*(const FixedPoint& other) const;
+    FixedPoint operator-() const;
+    FixedPoint& operator+=(const FixedPoint& other);
+    FixedPoint& operator-=(const FixedPoint& other);
+    FixedPoint& operator*=(const FixedPoint& other);
+
+    /**
+     * @brief mul2 Multiplication by 2^exponent (exponent may be negative)
+     */
+    FixedPoint mul2(int exponent) const;
+
+    double toDouble() const;
+    int getFractionBits() const;
+    const BigInteger& getMantissa() const;
+
+  private:
+    void _checkFractionBits(const FixedPoint& other) const;
+
+    BigInteger m_Mantissa;
+    int m_FractionBits;
+};
+} // namespace cf
+
+#endif // FIXED_POINT_H_H
@@ -0,0 +1,519 @@
+#ifndef FORMULA_FRACTAL_H_H
+#define FORMULA_FRACTAL_H_H
+
+#include "escapeTime.h"
+#include "internal.hpp"
+
+#include <cmath>
+
+namespace cf {
+
+/**
+ * @brief formula Compile time iteration formulas (expression templates) for cf::FormulaFractal
+ *
+ * a formula is built from the variables z(), c() and zPrev() (z of the previous iteration), constants and the operators
+ * +, -, *, /, e.g. the Mandelbrot set "pow<2>(z()) + c()" or the burning ship "pow<2>(absParts(z())) + c()",
+ * its type encodes the whole expression, which is evaluated lane by lane inside the vectorized iteration loops of
+ * cf::FormulaFractal (completely inlined, no virtual call or std::function per iteration)
+ */
+namespace formula {
+
+struct Value {
+    double re;
+    double im;
+};
+
+inline Value operator+(const Value& a, const Value& b) { return {a.re + b.re, a.im + b.im}; }
+inline Value operator-(const Value& a, const Value& b) { return {a.re - b.re, a.im - b.im}; }
+inline Value operator*(const Value& a, const Value& b) { return {a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re}; }
+inline Value operator/(const Value& a, const Value& b) {
+    const double inverse = 1.0 / (b.re * b.re + b.im * b.im);
+    return {(a.re * b.re + a.im * b.im) * inverse, (a.im * b.re - a.re * b.im) * inverse};
+}
+
+/**
+ * @brief The Variables struct Current values of all lanes (structure of arrays)
+ */
+struct Variables {
+    double zr[EscapeTime::LANES];
+    double zi[EscapeTime::LANES];
+    double pr[EscapeTime::LANES]; /* z of the previous iteration */
+    double pi[EscapeTime::LANES];
+    double cr[EscapeTime::LANES];
+    double ci[EscapeTime::LANES];
+};
+
+/**
+ * @brief The Expression struct Base of all formula nodes (CRTP), every node provides
+ * 'Value eval(const Variables& v, int lane) const'
+ */
+template <typename _Node> struct Expression {
+    const _Node& node() const { return static_cast<const _Node&>(*this); }
+};
+
+struct Z : Expression<Z> {
+    Value eval(const Variables& v, int l) const { return {v.zr[l], v.zi[l]}; }
+};
+struct C : Expression<C> {
+    Value eval(const Variables& v, int l) const { return {v.cr[l], v.ci[l]}; }
+};
+struct ZPrev : Expression<ZPrev> {
+    Value eval(const Variables& v, int l) const { return {v.pr[l], v.pi[l]}; }
+};
+struct Constant : Expression<Constant> {
+    Constant(double re, double im = 0.0) : value{re, im} {}
+    Value eval(const Variables&, int) const { return this->value; }
+    Value value;
+};
+
+template <typename _Lhs, typename _Rhs, typename _Operation> struct Binary : Expression<Binary<_Lhs, _Rhs, _Operation>> {
+    Binary(const _Lhs& lhs, const _Rhs& rhs) : lhs(lhs), rhs(rhs) {}
+    Value eval(const Variables& v, int l) const { return _Operation::apply(this->lhs.eval(v, l), this->rhs.eval(v, l)); }
+    _Lhs lhs;
+    _Rhs rhs;
+};
+
+struct _Add {
+    static Value apply(const Value& a, const Value& b) { return a + b; }
+};
+struct _Sub {
+    static Value apply(const Value& a, const Value& b) { return a - b; }
+};
+struct _Mul {
+    static Value apply(const Value& a, const Value& b) { return a * b; }
+};
+struct _Div {
+    static Value apply(const Value& a, const Value& b) { return a / b; }
+};
+
+/**
+ * @brief _Pow x^N by repeated squaring, unrolled at compile time
+ */
+template <int N> struct _Pow {
+    static Value apply(const Value& x) {
+        const Value half = _Pow<N / 2>::apply(x);
+        return N % 2 ? half * half * x : half * half;
+    }
+};
+template <> struct _Pow<0> {
+    static Value apply(const Value&) { return {1.0, 0.0}; }
+};
+
+template <int N, typename _Arg> struct Power : Expression<Power<N, _Arg>> {
+    static_assert(N >= 0, "Error: negative exponents are not supported, use division instead");
+    Power(const _Arg& arg) : arg(arg) {}
+    Value eval(const Variables& v, int l) const { return _Pow<N>::apply(this->arg.eval(v, l)); }
+    _Arg arg;
+};
+
+template <typename _Arg> struct AbsParts : Expression<AbsParts<_Arg>> {
+    AbsParts(const _Arg& arg) : arg(arg) {}
+    Value eval(const Variables& v, int l) const {
+        const Value x = this->arg.eval(v, l);
+        return {std::abs(x.re), std::abs(x.im)};
+    }
+    _Arg arg;
+};
+
+template <typename _Arg> struct Conjugate : Expression<Conjugate<_Arg>> {
+    Conjugate(const _Arg& arg) : arg(arg) {}
+    Value eval(const Variables& v, int l) const {
+        const Value x = this->arg.eval(v, l);
+        return {x.re, -x.im};
+    }
+    _Arg arg;
+};
+
+inline Z z() { return {}; }
+inline C c() { return {}; }
+inline ZPrev zPrev() { return {}; }
+inline Constant constant(double re, double im = 0.0) { return {re, im}; }
+inline Constant constant(const std::complex<double>& value) { return {value.real(), value.imag()}; }
+
+template <int N, typename _Arg> Power<N, _Arg> pow(const Expression<_Arg>& arg) { return {arg.node()}; }
+
+/**
+ * @brief absParts |Re(x)| + i * |Im(x)| (burning ship)
+ */
+template <typename _Arg> AbsParts<_Arg> absParts(const Expression<_Arg>& arg) { return {arg.node()}; }
+template <typename _Arg> Conjugate<_Arg> conj(const Expression<_Arg>& arg) { return {arg.node()}; }
+
+#define CF_FORMULA_OPERATOR(OP, OPERATION)                                                                              \
+    template <typename _Lhs, typename _Rhs>                                                                             \
+    Binary<_Lhs, _Rhs, OPERATION> operator OP(const Expression<_Lhs>& lhs, const Expression<_Rhs>& rhs) {              \
+        return {lhs.node(), rhs.node()};                                                                                \
+    }                                                                                                                   \
+    template <typename _Lhs> Binary<_Lhs, Constant, OPERATION> operator OP(const Expression<_Lhs>& lhs, double rhs) {  \
+        return {lhs.node(), Constant(rhs)};                                                                             \
+    }                                                                                                                   \
+    template <typename _Rhs> Binary<Constant, _Rhs, OPERATION> operator OP(double lhs, const Expression<_Rhs>& rhs) {  \
+        return {Constant(lhs), rhs.node()};                                                                             \
+    }
+CF_FORMULA_OPERATOR(+, _Add)
+CF_FORMULA_OPERATOR(-, _Sub)
+CF_FORMULA_OPERATOR(*, _Mul)
+CF_FORMULA_OPERATOR(/, _Div)
+#undef CF_FORMULA_OPERATOR
+
+// common formulas
+inline auto mandelbrot() -> decltype(pow<2>(z()) + c()) { return pow<2>(z()) + c(); }
+inline auto burningShip() -> decltype(pow<2>(absParts(z())) + c()) { return pow<2>(absParts(z())) + c(); }
+template <int N> auto multibrot() -> decltype(pow<N>(z()) + c()) { return pow<N>(z()) + c(); }
+
+/**
+ * @brief phoenix z' = z^2 + c + p * zPrev, usually rendered as Julia set with a real c (the common parameter plane is
+ * c = Re(pixel), p = Im(pixel), here p is a constant and c may be complex)
+ */
+inline auto phoenix(double p) -> decltype(pow<2>(z()) + c() + constant(p) * zPrev()) {
+    return pow<2>(z()) + c() + constant(p) * zPrev();
+}
+
+/**
+ * @brief newton Newton's method z' = z - (z^N - 1) / (N * z^(N - 1)) for the N-th roots of unity
+ */
+template <int N>
+auto newton() -> decltype(z() - (pow<N>(z()) - 1.0) / (double(N) * pow<N - 1>(z()))) {
+    return z() - (pow<N>(z()) - 1.0) / (double(N) * pow<N - 1>(z()));
+}
+} // namespace formula
+
+/**
+ * @brief The RootBasins struct Result of cf::FormulaFractal::calculateRoots
+ */
+struct RootBasins {
+    int width = 0;
+    int height = 0;
+    uint32_t maxIterations = 0;
+    std::vector<int32_t> roots;                 /* row major, index into 'rootValues', -1 -> not converged */
+    std::vector<uint32_t> iterations;           /* iterations until convergence */
+    std::vector<std::complex<double>> rootValues;
+    std::size_t evaluations = 0;
+
+    /**
+     * @brief render Root 'n' uses the palette entry n % size, which is darkened by 1 / (1 + shading * iterations)
+     */
+    static void render(const RootBasins& basins, cf::WindowVectorized& window, const std::vector<cf::Color>& palette,
+                       double shading = 0.05, const cf::Color& notConverged = cf::Color::BLACK);
+};
+
+/**
+ * @brief The FormulaFractal struct iterates an arbitrary compile time formula (see cf::formula) for every pixel
+ *
+ * like cf::EscapeTime the image is split into tiles (dynamic scheduling over all threads), within a tile the pixels are
+ * iterated in lane groups, finished lanes are masked out arithmetically, the formula is inlined into the lane loop
+ *
+ * - calculate: escape time (z_0 = 0, c = pixel, Julia sets: z_0 = pixel, c = constant), compatible with cf::ColorMap
+ * - calculateRoots: root finding (z_0 = pixel, c = constant), a pixel converged as soon as |z' - z| < tolerance
+ */
+template <typename _Formula> struct FormulaFractal {
+    static constexpr const int LANES = EscapeTime::LANES;
+
+    FormulaFractal(const _Formula& formula) : m_Formula(formula) {}
+
+    /**
+     * @brief Julia z_0 = pixel, c = 'c' (the formula should reference c())
+     */
+    static FormulaFractal Julia(const _Formula& formula, const std::complex<double>& c) {
+        FormulaFractal fractal(formula);
+        fractal.m_Julia = true;
+        fractal.m_C = c;
+        return fractal;
+    }
+
+    void setMaxIterations(uint32_t maxIterations) {
+        if (!maxIterations)
+            throw std::runtime_error(R"(Error: zero iterations in function "FormulaFractal::setMaxIterations")");
+        this->m_MaxIterations = maxIterations;
+    }
+    /**
+     * @brief setEscapeRadius Orbits with |z| > radius are treated as escaped (default 2, maximum 1e50), the radius is
+     * lowered for formulas, which would overflow beyond it (e.g. pow<8> beyond about 1e38, see EscapeTime::Result)
+     */
+    void setEscapeRadius(double radius) {
+        if (!(radius > 0.0 && radius <= 1e50))
+            throw std::runtime_error(R"(Error: radius not within (0, 1e50] in function "FormulaFractal::setEscapeRadius")");
+        this->m_EscapeRadius = radius;
+    }
+
+    /**
+     * @brief setRootTolerance Convergence tolerance of calculateRoots (default 1e-9)
+     */
+    void setRootTolerance(double tolerance) {
+        if (!(tolerance > 0.0))
+            throw std::runtime_error(R"(Error: tolerance has to be positive in function "FormulaFractal::setRootTolerance")");
+        this->m_RootTolerance = tolerance;
+    }
+
+    /**
+     * @brief setConstant Value of c() for calculateRoots (default 0)
+     */
+    void setConstant(const std::complex<double>& c) { this->m_C = c; }
+    void setNumThreads(unsigned numThreads) { this->m_NumThreads = numThreads; }
+
+    EscapeTime::Result calculate(int width, int height, const cf::Interval& range_x, const cf::Interval& range_y) const {
+        _CheckSize(width, height, "FormulaFractal::calculate");
+        EscapeTime::Result result;
+        result.width = width;
+        result.height = height;
+        result.maxIterations = this->m_MaxIterations;
+        const double cMax = this->m_Julia ? std::abs(this->m_C)
+                                          : std::max(std::max(std::abs(range_x.min), std::abs(range_x.max)),
+                                                     std::max(std::abs(range_y.min), std::abs(range_y.max))) * std::sqrt(2.0);
+        result.escapeRadius = this->_escapeRadius(cMax);
+        result.iterations.resize(std::size_t(width) * height);
+        result.norms.resize(result.iterations.size());
+        this->_forEachLaneGroup(width, height, range_x, range_y, [&](const double* x, const double* y, std::size_t offset,
+                                                                      int numLanes) {
+            uint32_t iterations[LANES];
+            double norms[LANES];
+            this->_escapeLanes(x, y, result.escapeRadius, iterations, norms);
+            for (int l = 0; l < numLanes; ++l) {
+                result.iterations[offset + l] = iterations[l];
+                result.norms[offset + l] = norms[l];
+            }
+        });
+        for (const auto& i : result.iterations)
+            result.evaluations += i;
+        result.computedPixels = result.iterations.size();
+        return result;
+    }
+
+    RootBasins calculateRoots(int width, int height, const cf::Interval& range_x, const cf::Interval& range_y) const {
+        _CheckSize(width, height, "FormulaFractal::calculateRoots");
+        RootBasins basins;
+        basins.width = width;
+        basins.height = height;
+        basins.maxIterations = this->m_MaxIterations;
+        basins.iterations.resize(std::size_t(width) * height);
+        std::vector<std::complex<double>> values(basins.iterations.size());
+        this->_forEachLaneGroup(width, height, range_x, range_y, [&](const double* x, const double* y, std::size_t offset,
+                                                                      int numLanes) {
+            uint32_t iterations[LANES];
+            double zr[LANES], zi[LANES];
+            this->_rootLanes(x, y, iterations, zr, zi);
+            for (int l = 0; l < numLanes; ++l) {
+                basins.iterations[offset + l] = iterations[l];
+                values[offset + l] = {zr[l], zi[l]};
+            }
+        });
+        for (const auto& i : basins.iterations)
+            basins.evaluations += i;
+
+        // roots are identified after the iteration (only a few distinct roots, no synchronization of the threads)
+        const double matchTolerance2 = std::pow(std::max(1e-6, 1e3 * this->m_RootTolerance), 2.0);
+        basins.roots.assign(values.size(), -1);
+        for (std::size_t idx = 0; idx < values.size(); ++idx) {
+            if (basins.iterations[idx] >= this->m_MaxIterations || !std::isfinite(std::norm(values[idx])))
+                continue;
+            const int32_t numRoots = int32_t(basins.rootValues.size());
+            int32_t root = 0;
+            while (root < numRoots && std::norm(basins.rootValues[root] - values[idx]) > matchTolerance2)
+                ++root;
+            if (root == numRoots)
+                basins.rootValues.push_back(values[idx]);
+            basins.roots[idx] = root;
+        }
+        return basins;
+    }
+
+    void render(cf::WindowVectorized& window, const std::vector<cf::Color>& palette,
+                const cf::Color& insideColor = cf::Color::BLACK) const {
+        cv::Mat& image = window.getImage();
+        EscapeTime::render(this->calculate(image.cols, image.rows, window.getIntervalX(), window.getIntervalY()), window,
+                           palette, insideColor);
+    }
+
+  private:
+    static constexpr const int TILE_SIZE = 64;            // has to be a multiple of LANES
+    static constexpr const uint32_t BLOCK_ITERATIONS = 8; // iterations between two "all lanes finished" checks
+
+    static double _Mask(double x) { return 0.5 + 0.5 * std::copysign(1.0, x); } // 1.0 for x >= 0, 0.0 otherwise
+
+    static void _CheckSize(int width, int height, const char* function) {
+        if (width <= 0 || height <= 0)
+            throw std::runtime_error(std::string(R"(Error: invalid image size in function ")") + function + "\"");
+    }
+
+    /**
+     * @brief _forEachLaneGroup Calls 'function(x, y, offset, numLanes)' for all lane groups of all tiles in parallel
+     * (incomplete lane groups repeat the last column)
+     */
+    template <typename _Function>
+    void _forEachLaneGroup(int width, int height, const cf::Interval& range_x, const cf::Interval& range_y,
+                           const _Function& function) const {
+        const double stepX = (double(range_x.max) - double(range_x.min)) / width;
+        const double stepY = (double(range_y.max) - double(range_y.min)) / height;
+        const int tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+        const int tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+        internal::_ParallelFor(std::size_t(tilesX) * tilesY, this->m_NumThreads, [&](unsigned, std::size_t tile) {
+            const int tileX = int(tile % tilesX) * TILE_SIZE;
+            const int tileY = int(tile / tilesX) * TILE_SIZE;
+            double x[LANES], y[LANES];
+            for (int row = tileY; row < std::min(height, tileY + TILE_SIZE); ++row) {
+                std::fill(y, y + LANES, range_y.max - (row + 0.5) * stepY);
+                for (int col = tileX; col < std::min(width, tileX + TILE_SIZE); col += LANES) {
+                    for (int l = 0; l < LANES; ++l)
+                        x[l] = range_x.min + (std::min(col + l, width - 1) + 0.5) * stepX;
+                    function(x, y, std::size_t(row) * width + col, std::min(LANES, width - col));
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief _escapeRadius The escape radius lowered until the formula maps |z| = radius (and |c| <= 'cMax') to a finite
+     * |z'|^2, so the value of an escaping lane and its norm stay finite
+     */
+    double _escapeRadius(double cMax) const {
+        auto isFinite = [&](double radius) {
+            formula::Variables v;
+            for (int k = 0; k < 8; ++k) {
+                const double cosA = std::cos(k * 0.25 * glm::pi<double>()), sinA = std::sin(k * 0.25 * glm::pi<double>());
+                v.zr[0] = v.pr[0] = radius * cosA;
+                v.zi[0] = v.pi[0] = radius * sinA;
+                v.cr[0] = cMax * cosA;
+                v.ci[0] = cMax * sinA;
+                const formula::Value next = this->m_Formula.eval(v, 0);
+                if (!std::isfinite(next.re * next.re + next.im * next.im))
+                    return false;
+            }
+            return true;
+        };
+        if (this->m_EscapeRadius <= 2.0 || isFinite(this->m_EscapeRadius))
+            return this->m_EscapeRadius;
+
+        // bisection of log(radius) within [log(2), log(radius)]
+        double low = std::log(2.0), high = std::log(this->m_EscapeRadius);
+        for (int i = 0; i < 40; ++i) {
+            const double middle = 0.5 * (low + high);
+            (isFinite(std::exp(middle)) ? low : high) = middle;
+        }
+        return std::exp(low);
+    }
+
+    /**
+     * @brief _escapeLanes Escape time of 'LANES' pixels, escaped lanes keep their last value in 'norms'
+     *
+     * escaped lanes continue with z = 0 (masked before the formula is evaluated, their result is masked out), the formula
+     * never sees values beyond the escape radius, which could overflow (blending infinite values would result in NaN),
+     * 'radius' keeps the value of an escaping lane finite (see _escapeRadius)
+     */
+    void _escapeLanes(const double* x, const double* y, double radius, uint32_t* iterations, double* norms) const {
+        formula::Variables v;
+        double active[LANES], count[LANES], finalR[LANES], finalI[LANES];
+        for (int l = 0; l < LANES; ++l) {
+            v.zr[l] = this->m_Julia ? x[l] : 0.0;
+            v.zi[l] = this->m_Julia ? y[l] : 0.0;
+            v.cr[l] = this->m_Julia ? this->m_C.real() : x[l];
+            v.ci[l] = this->m_Julia ? this->m_C.imag() : y[l];
+            v.pr[l] = 0.0;
+            v.pi[l] = 0.0;
+            active[l] = 1.0;
+            count[l] = 0.0;
+            finalR[l] = 0.0;
+            finalI[l] = 0.0;
+        }
+
+        const double radius2 = radius * radius;
+        double anyActive = LANES;
+        for (uint32_t iter = 0; iter < this->m_MaxIterations && anyActive != 0.0;) {
+            const uint32_t blockEnd = std::min(this->m_MaxIterations, iter + BLOCK_ITERATIONS);
+            for (; iter < blockEnd; ++iter) {
+                for (int l = 0; l < LANES; ++l) {
+                    const double wasActive = active[l];
+                    active[l] *= _Mask(radius2 - (v.zr[l] * v.zr[l] + v.zi[l] * v.zi[l]));
+                    finalR[l] = wasActive * v.zr[l] + (1.0 - wasActive) * finalR[l];
+                    finalI[l] = wasActive * v.zi[l] + (1.0 - wasActive) * finalI[l];
+
+                    v.zr[l] *= active[l];
+                    v.zi[l] *= active[l];
+                    const formula::Value next = this->m_Formula.eval(v, l);
+                    v.pr[l] = v.zr[l];
+                    v.pi[l] = v.zi[l];
+                    v.zr[l] = active[l] * next.re;
+                    v.zi[l] = active[l] * next.im;
+                    count[l] += active[l];
+                }
+            }
+
+            anyActive = 0.0;
+            for (int l = 0; l < LANES; ++l)
+                anyActive += active[l];
+        }
+
+        for (int l = 0; l < LANES; ++l) {
+            iterations[l] = uint32_t(count[l]);
+            // lanes, which are still active, did not escape
+            const double r = active[l] != 0.0 ? v.zr[l] : finalR[l];
+            const double i = active[l] != 0.0 ? v.zi[l] : finalI[l];
+            norms[l] = r * r + i * i;
+        }
+    }
+
+    /**
+     * @brief _rootLanes Iterates 'LANES' pixels until z converged, converged lanes keep their value
+     */
+    void _rootLanes(const double* x, const double* y, uint32_t* iterations, double* zr, double* zi) const {
+        formula::Variables v;
+        double active[LANES], count[LANES];
+        for (int l = 0; l < LANES; ++l) {
+            v.zr[l] = x[l];
+            v.zi[l] = y[l];
+            v.cr[l] = this->m_C.real();
+            v.ci[l] = this->m_C.imag();
+            v.pr[l] = 0.0;
+            v.pi[l] = 0.0;
+            active[l] = 1.0;
+            count[l] = 0.0;
+        }
+
+        // non finite lanes (e.g. a division by zero) never converge, their mask stays 1.0 or 0.0 (copysign of NaN)
+        const double tolerance2 = this->m_RootTolerance * this->m_RootTolerance;
+        double anyActive = LANES;
+        for (uint32_t iter = 0; iter < this->m_MaxIterations && anyActive != 0.0;) {
+            const uint32_t blockEnd = std::min(this->m_MaxIterations, iter + BLOCK_ITERATIONS);
+            for (; iter < blockEnd; ++iter) {
+                for (int l = 0; l < LANES; ++l) {
+                    const formula::Value next = this->m_Formula.eval(v, l);
+                    const double dr = next.re - v.zr[l];
+                    const double di = next.im - v.zi[l];
+                    const double wasActive = active[l];
+                    active[l] *= _Mask(dr * dr + di * di - tolerance2);
+                    v.pr[l] = wasActive * v.zr[l] + (1.0 - wasActive) * v.pr[l];
+                    v.pi[l] = wasActive * v.zi[l] + (1.0 - wasActive) * v.pi[l];
+                    v.zr[l] = wasActive * next.re + (1.0 - wasActive) * v.zr[l];
+                    v.zi[l] = wasActive * next.im + (1.0 - wasActive) * v.zi[l];
+                    count[l] += wasActive;
+                }
+            }
+
+            anyActive = 0.0;
+            for (int l = 0; l < LANES; ++l)
+                anyActive += active[l];
+        }
+
+        for (int l = 0; l < LANES; ++l) {
+            iterations[l] = active[l] != 0.0 ? this->m_MaxIterations : uint32_t(count[l]);
+            zr[l] = v.zr[l];
+            zi[l] = v.zi[l];
+        }
+    }
+
+    _Formula m_Formula;
+    bool m_Julia = false;
+    std::complex<double> m_C;
+    uint32_t m_MaxIterations = 256;
+    double m_EscapeRadius = 2.0;
+    double m_RootTolerance = 1e-9;
+    unsigned m_NumThreads = 0;
+};
+
+/**
+ * @brief makeFormulaFractal Deduces the formula type, e.g. makeFormulaFractal(formula::burningShip())
+ */
+template <typename _Formula> FormulaFractal<_Formula> makeFormulaFractal(const _Formula& formula) {
+    return FormulaFractal<_Formula>(formula);
+}
+} // namespace cf
+
+#endif // FORMULA_FRACTAL_H_H
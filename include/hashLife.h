@@ -0,0 +1,132 @@
+#ifndef HASH_LIFE_H_H
+#define HASH_LIFE_H_H
+
+#include "windowRasterized.h"
+
+namespace cf {
+
+/**
+ * @brief The HashLife struct Conway's Game of Life (B3/S23) on an unbounded grid with Gosper's HashLife algorithm
+ *
+ * the universe is a quadtree, a node of level k covers 2^k x 2^k cells, nodes are hash-consed (an open addressing hash
+ * table of the four children, every pattern exists once), so repeated structures share their nodes, every node of
+ * level k memoizes its result: the center 2^(k-1) x 2^(k-1) cells 2^(k-2) generations ahead (or 2^j generations for a
+ * step size 2^j < 2^(k-2)), a run of n generations advances the root by the powers of two of n
+ *
+ * memory: nodes unreachable from the root are collected (mark and sweep, memoized results of reachable nodes are kept as
+ * long as possible), when the node memory exceeds the limit, the collection runs between two steps
+ */
+struct HashLife {
+    static constexpr const int MAX_LEVEL = 62; /* the root covers at most 2^62 x 2^62 cells */
+
+    HashLife();
+
+    /**
+     * @brief FromDATFile Reads a pattern of a .dat file (e.g. Life2.dat, see cf::readDATFile)
+     */
+    static HashLife FromDATFile(const std::string& filePath);
+
+    /**
+     * @brief load Sets the cells of 'points' (x, y, state) alive (state != 0), the pattern is moved by 'offsetX'/'offsetY'
+     */
+    void load(const std::vector<glm::vec3>& points, int64_t offsetX = 0, int64_t offsetY = 0);
+
+    bool get(int64_t x, int64_t y) const;
+    void set(int64_t x, int64_t y, bool alive);
+    void clear();
+
+    /**
+     * @brief run Computes 'generations' further generations
+     */
+    void run(uint64_t generations);
+
+    uint64_t getGeneration() const;
+    uint64_t getPopulation() const;
+
+    /**
+     * @brief getBounds Bounding box of all living cells (inclusive)
+     * @return False, if there are no living cells
+     */
+    bool getBounds(int64_t& minX, int64_t& minY, int64_t& maxX, int64_t& maxY) const;
+
+    /**
+     * @brief setMemoryLimit Node memory, which triggers a garbage collection (default 1 GiB)
+     */
+    void setMemoryLimit(std::size_t bytes);
+
+    /**
+     * @brief collectGarbage Frees all nodes, which are not reachable from the root
+     * @param keepResults False -> memoized results are dropped as well
+     */
+    void collectGarbage(bool keepResults = true);
+
+    std::size_t getNumNodes() const;
+
+    /**
+     * @brief getMemoryUsage Bytes of the nodes and the hash table
+     */
+    std::size_t getMemoryUsage() const;
+
+    /**
+     * @brief render Draws the region of 'columns' x 'rows' cells starting at the cell 'minX'/'minY' (top left) scaled to
+     * the whole image, a pixel covering several cells is alive, if any of them is alive
+     */
+    void render(cv::Mat& image, int64_t minX, int64_t minY, int64_t columns, int64_t rows,
+                const cf::Color& alive = cf::Color::WHITE, const cf::Color& dead = cf::Color::BLACK) const;
+    void render(cf::WindowRasterized& window, int64_t minX, int64_t minY, int64_t columns, int64_t rows,
+                const cf::Color& alive = cf::Color::WHITE, const cf::Color& dead = cf::Color::BLACK) const;
+
+    /**
+     * @brief render Draws the bounding box of all living cells
+     */
+    void render(cf::WindowRasterized& window, const cf::Color& alive = cf::Color::WHITE,
+                const cf::Color& dead = cf::Color::BLACK) const;
+
+  private:
+    /**
+     * @brief The _Node struct Quadtree node (children are node indices), level 0 nodes are the cells DEAD and ALIVE
+     */
+    struct _Node {
+        uint32_t nw;
+        uint32_t ne;
+        uint32_t sw;
+        uint32_t se;
+        uint32_t result; /* NONE -> not calculated yet */
+        uint8_t level;
+        bool marked;
+        uint64_t population;
+    };
+    static constexpr const uint32_t NONE = 0;
+    static constexpr const uint32_t DEAD = 1;
+    static constexpr const uint32_t ALIVE = 2;
+
+    uint32_t _node(uint32_t nw, uint32_t ne, uint32_t sw, uint32_t se);
+    uint32_t _empty(int level);
+    uint32_t _set(uint32_t node, int64_t x, int64_t y, bool alive);
+    uint32_t _center(uint32_t node);
+    uint32_t _horizontal(uint32_t west, uint32_t east);
+    uint32_t _vertical(uint32_t north, uint32_t south);
+    uint32_t _successor(uint32_t node);
+    uint32_t _leafSuccessor(uint32_t node);
+    void _expand();
+    bool _fitsCenter() const;
+    void _setStep(int step);
+    void _insert(uint32_t node);
+    void _grow();
+    void _mark(uint32_t node, bool keepResults);
+    void _render(cv::Mat& image, uint32_t node, int64_t x, int64_t y, int64_t minX, int64_t minY, int64_t columns,
+                 int64_t rows, const cf::Color& alive) const;
+
+    std::vector<_Node> m_Nodes;
+    std::vector<uint32_t> m_Table; /* hash table of node indices, NONE -> empty slot, power of two size */
+    std::vector<uint32_t> m_Free;  /* collected node indices */
+    std::vector<uint32_t> m_Empty; /* level -> empty node */
+    std::size_t m_NumNodes = 0;    /* nodes in the hash table */
+    uint32_t m_Root;
+    int m_Step = 0; /* log2 of the generations of a successor */
+    uint64_t m_Generation = 0;
+    std::size_t m_MemoryLimit = std::size_t(1) << 30;
+};
+} // namespace cf
+
+#endif // HASH_LIFE_H_H
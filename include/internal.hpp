@@ -1,7 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <functional>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 namespace cf {
 namespace internal {
@@ -26,5 +33,104 @@ template <typename _ReturnType, typename... _Args> struct _ProtectedFunction<_Re
     std::function<_ReturnType(_Args...)> m_ProtectType;
 };
 
+/**
+ * @brief _NumThreads Number of worker threads to be used
+ * @param requested Requested number of threads, 0 -> number of hardware threads
+ * @param maxUseful Upper bound, e.g. number of work items
+ */
+inline unsigned _NumThreads(unsigned requested, std::size_t maxUseful) {
+    if (!requested)
+        requested = std::max(1u, std::thread::hardware_concurrency());
+    return unsigned(std::max<std::size_t>(1, std::min<std::size_t>(requested, maxUseful)));
+}
+
+/**
+ * @brief _ParallelFor Calls 'function(threadIndex, index)' for every index in [0, count)
+ *
+ * dynamic scheduling: every thread fetches the next index from a shared counter,
+ * the calling thread works as thread 0, the first exception will be rethrown after all threads finished
+ */
+template <typename _Function> void _ParallelFor(std::size_t count, unsigned numThreads, _Function&& function) {
+    numThreads = _NumThreads(numThreads, count);
+
+    std::atomic<std::size_t> next(0);
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+    auto worker = [&](unsigned threadIndex) {
+        try {
+            for (std::size_t idx = next++; idx < count; idx = next++)
+                function(threadIndex, idx);
+        } catch (...) {
+            std::lock_guard<std::mutex> lg(exceptionMutex);
+            if (!exception)
+                exception = std::current_exception();
+            next = count; // stop all other threads
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (unsigned t = 1; t < numThreads; ++t)
+        threads.emplace_back(worker, t);
+    worker(0);
+    for (auto& t : threads)
+        t.join();
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+/**
+ * @brief _BoundedQueue Thread safe FIFO queue with a maximum size (producer/consumer)
+ *
+ * 'push' blocks while the queue is full, 'pop' blocks while it is empty,
+ * after 'close' pushing fails and popping returns the remaining items only
+ */
+template <typename _Type> struct _BoundedQueue {
+    _BoundedQueue(std::size_t capacity) : m_Capacity(std::max<std::size_t>(1, capacity)) {}
+
+    /**
+     * @brief push Appends an item, returns false if the queue has been closed
+     */
+    bool push(_Type item) {
+        std::unique_lock<std::mutex> lock(this->m_Mutex);
+        this->m_NotFull.wait(lock, [this]() { return this->m_Closed || this->m_Items.size() < this->m_Capacity; });
+        if (this->m_Closed)
+            return false;
+        this->m_Items.push_back(std::move(item));
+        this->m_NotEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief pop Removes the oldest item, returns false if the queue has been closed and is empty
+     */
+    bool pop(_Type& item) {
+        std::unique_lock<std::mutex> lock(this->m_Mutex);
+        this->m_NotEmpty.wait(lock, [this]() { return this->m_Closed || !this->m_Items.empty(); });
+        if (this->m_Items.empty())
+            return false;
+        item = std::move(this->m_Items.front());
+        this->m_Items.pop_front();
+        this->m_NotFull.notify_one();
+        return true;
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> lg(this->m_Mutex);
+        this->m_Closed = true;
+        this->m_NotFull.notify_all();
+        this->m_NotEmpty.notify_all();
+    }
+
+  private:
+    std::size_t m_Capacity;
+    bool m_Closed = false;
+    std::deque<_Type> m_Items;
+    std::mutex m_Mutex;
+    std::condition_variable m_NotFull;
+    std::condition_variable m_NotEmpty;
+};
+
 } // namespace internal
 } // namespace cf
@@ -0,0 +1,49 @@
+#ifndef INVERSE_JULIA_H_H
+#define INVERSE_JULIA_H_H
+
+#include "densityCanvas.h"
+
+#include <complex>
+
+namespace cf {
+
+/**
+ * @brief The InverseJulia struct draws the boundary of Julia sets z' = z^2 + c by the modified inverse iteration
+ * method (MIIM)
+ *
+ * the repelling fixed point of z^2 + c lies on the Julia set, its preimages z = +-sqrt(z' - c) form a binary tree,
+ * which is traversed depth first (explicit stack), every visited point increments the hit count of its pixel and
+ * branches ending in saturated pixels are pruned, which avoids the oversampling of the naive inverse iteration
+ *
+ * the first tree levels are split into independent branches distributed over all hardware threads (shared atomic
+ * hit counts), points outside of the canvas are counted on a coarse guard grid covering the whole Julia set
+ */
+struct InverseJulia {
+    InverseJulia(const std::complex<double>& c);
+
+    /**
+     * @brief setMaxHits Hit count per pixel (and guard grid cell) at which branches are pruned (default 2)
+     */
+    void setMaxHits(uint32_t maxHits);
+    void setNumThreads(unsigned numThreads);
+
+    /**
+     * @brief calculate Adds the hits of all visited points to the canvas
+     * @return Number of visited points
+     */
+    std::size_t calculate(cf::DensityCanvas& canvas) const;
+
+    /**
+     * @brief render Calculates the Julia set within the window intervals
+     * @param palette Color palette (see cf::DensityCanvas::render)
+     */
+    void render(cf::WindowVectorized& window, const std::vector<cf::Color>& palette = {}) const;
+
+  private:
+    std::complex<double> m_C;
+    uint32_t m_MaxHits = 2;
+    unsigned m_NumThreads = 0;
+};
+} // namespace cf
+
+#endif // INVERSE_JULIA_H_H
@@ -0,0 +1,104 @@
+#ifndef LIFE_H_H
+#define LIFE_H_H
+
+#include "windowRasterized.h"
+
+namespace cf {
+
+/**
+ * @brief The Life struct Conway's Game of Life (B3/S23) on a bit-packed grid
+ *
+ * every row is stored as 64 cells per word (bit i of word k is the column 64 * k + i), a generation works on 64 cells
+ * at once: the words of a row are shifted by one column and the cells x - 1, x, x + 1 are summed up with bit-sliced
+ * adders (two bit planes, every row is summed once and used by the three rows next to it), the sums of three rows are
+ * added to the count of the 3 x 3 block (four bit planes) and the rule is a boolean expression of the bit planes, the
+ * loops over the words of a row contain no branches and are vectorized by the compiler, stripes of rows are
+ * distributed over threads (double buffered, no synchronization within a generation)
+ *
+ * active tiles: the grid is split into tiles of 64 x 32 cells (one word wide), a generation only computes the tiles next
+ * to a tile, which differs from two generations ago, all other tiles repeat the last generation (still lifes and period 2
+ * oscillators, e.g. the ash of a soup), which the next buffer already holds, the flags are double buffered as well and
+ * every flag is written by the task of its row of tiles only (no synchronization besides the end of a generation)
+ *
+ * topology: the cells outside of the grid are dead (PLANE) or the grid wraps around (TORUS, the width has to be a
+ * multiple of 64)
+ */
+struct Life {
+    enum class Topology { PLANE, TORUS };
+
+    Life(int width, int height, Topology topology = Topology::TORUS);
+
+    /**
+     * @brief FromDATFile Reads a pattern of a .dat file (e.g. Life1.dat, see cf::readDATFile), the pattern is centered
+     */
+    static Life FromDATFile(const std::string& filePath, int width, int height, Topology topology = Topology::TORUS);
+
+    /**
+     * @brief load Sets the cells of 'points' (x, y, state) alive (state != 0), the pattern is moved by 'offsetX'/'offsetY'
+     */
+    void load(const std::vector<glm::vec3>& points, int offsetX = 0, int offsetY = 0);
+
+    /**
+     * @brief randomize Random soup, every cell is alive with the probability 'density'
+     */
+    void randomize(double density, uint32_t seed);
+
+    bool get(int x, int y) const;
+    void set(int x, int y, bool alive);
+    void clear();
+
+    /**
+     * @brief step Computes 'generations' further generations
+     */
+    void step(uint64_t generations = 1);
+
+    void setNumThreads(unsigned numThreads);
+
+    /**
+     * @brief setActiveTiles Computes only the tiles next to changes of the last generation (default on), off -> every
+     * generation computes all cells
+     */
+    void setActiveTiles(bool enabled);
+
+    /**
+     * @brief getNumChangedTiles Number of tiles (64 x 32 cells), which differ from two generations ago
+     */
+    std::size_t getNumChangedTiles() const;
+
+    uint64_t getGeneration() const;
+    uint64_t getPopulation() const;
+    int getWidth() const;
+    int getHeight() const;
+    Topology getTopology() const;
+
+    /**
+     * @brief getWords Cells of the grid, 'getWordsPerRow' words per row (bits beyond the width are 0)
+     */
+    const std::vector<uint64_t>& getWords() const;
+    int getWordsPerRow() const;
+
+    /**
+     * @brief render Draws the whole grid scaled to the image (nearest neighbour)
+     */
+    void render(cv::Mat& image, const cf::Color& alive = cf::Color::WHITE, const cf::Color& dead = cf::Color::BLACK) const;
+    void render(cf::WindowRasterized& window, const cf::Color& alive = cf::Color::WHITE,
+                const cf::Color& dead = cf::Color::BLACK) const;
+
+  private:
+    int m_Width;
+    int m_Height;
+    int m_WordsPerRow;
+    Topology m_Topology;
+    uint64_t m_LastWordMask; /* valid bits of the last word of a row */
+    std::vector<uint64_t> m_Words;
+    std::vector<uint64_t> m_Next;
+    std::vector<uint8_t> m_Changed;     /* tiles (row major, one word wide), which differ from two generations ago */
+    std::vector<uint8_t> m_NextChanged; /* flags of the next generation */
+    bool m_ActiveTiles = true;
+    int m_FullGenerations = 2; /* the cells were modified, the next generations compute all tiles */
+    uint64_t m_Generation = 0;
+    unsigned m_NumThreads = 0;
+};
+} // namespace cf
+
+#endif // LIFE_H_H
@@ -0,0 +1,78 @@
+#ifndef LYAPUNOV_MAP_H_H
+#define LYAPUNOV_MAP_H_H
+
+#include "orbitEngine.h"
+#include "windowVectorized.h"
+
+namespace cf {
+
+/**
+ * @brief The LyapunovMap struct calculates the largest lyapunov exponent for every pixel of a two parameter slice
+ *
+ * two modes are supported:
+ *  - orbit slice: two factors of a cf::Orbit are mapped onto the x and y axis, the exponent is calculated with the
+ *    analytic jacobian of the cf::OrbitMap
+ *  - Markus-Lyapunov: logistic map x' = r * x * (1 - x), where 'r' follows a sequence like "AB" (A -> x axis, B -> y axis)
+ *
+ * the image is split into tiles, which are distributed over all hardware threads,
+ * within a tile neighbouring pixels are iterated together in lane groups of 'LANES' pixels
+ */
+struct LyapunovMap {
+    static constexpr const int LANES = 8;
+
+    /**
+     * @brief LyapunovMap Orbit slice constructor
+     * @param orbit Orbit providing the remaining factors and the starting point
+     * @param factorIndexX Factor mapped onto the x axis (0 -> 'a', ... 9 -> 'j')
+     * @param factorIndexY Factor mapped onto the y axis
+     */
+    LyapunovMap(const cf::Orbit& orbit, std::size_t factorIndexX, std::size_t factorIndexY);
+    LyapunovMap(const cf::OrbitMap& map, const glm::dvec2& startingPoint, std::size_t factorIndexX, std::size_t factorIndexY);
+
+    /**
+     * @brief MarkusLyapunov Creates a Markus-Lyapunov map
+     * @param sequence Sequence of 'A' and 'B', e.g. "AB" or "BBBBBBAAAAAA"
+     */
+    static LyapunovMap MarkusLyapunov(const std::string& sequence);
+
+    /**
+     * @brief setIterations Sets the iteration budget per pixel
+     * @param transient Number of iterations before the exponent will be accumulated
+     * @param iterations Number of accumulated iterations
+     */
+    void setIterations(std::size_t transient, std::size_t iterations);
+    void setNumThreads(unsigned numThreads);
+
+    /**
+     * @brief calculate Calculates all exponents
+     * @return Exponents, row major, row 0 is the top most row (y interval is displayed bottom up)
+     */
+    std::vector<float> calculate(int width, int height, const cf::Interval& range_x, const cf::Interval& range_y) const;
+
+    /**
+     * @brief render Calculates the exponents within the window intervals and colors them
+     * @param palette Color palette (e.g. from cf::readPaletteFromFile), negative exponents use the palette entries 1 - n,
+     * positive (chaotic) or diverging pixels use the first entry
+     */
+    void render(cf::WindowVectorized& window, const std::vector<cf::Color>& palette) const;
+
+  private:
+    enum class Mode { ORBIT_SLICE, MARKUS_LYAPUNOV };
+    LyapunovMap() = default;
+
+    void _calculateLanes(const double* paramX, double paramY, float* result) const;
+
+    Mode m_Mode = Mode::ORBIT_SLICE;
+    cf::OrbitMap m_Map;
+    glm::dvec2 m_StartingPoint = glm::dvec2(0.0);
+    std::size_t m_FactorIndexX = 0;
+    std::size_t m_FactorIndexY = 1;
+    std::vector<uint8_t> m_Sequence; // 0 -> A, 1 -> B
+
+    std::size_t m_TransientIterations = 100;
+    std::size_t m_Iterations = 1000;
+    unsigned m_NumThreads = 0;
+};
+} // namespace cf
+
+#endif // LYAPUNOV_MAP_H_H
@@ -0,0 +1,487 @@
+#ifndef MULTI_PRECISION_H_H
+#define MULTI_PRECISION_H_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace cf {
+
+struct DoubleDouble;
+struct QuadDouble;
+
+namespace internal {
+
+// error free transformations (exact as long as the compiler does not reassociate, do not use -ffast-math)
+
+/**
+ * @brief _TwoSum s + e = a + b exactly (s = fl(a + b))
+ */
+inline double _TwoSum(double a, double b, double& e) {
+    const double s = a + b;
+    const double bb = s - a;
+    e = (a - (s - bb)) + (b - bb);
+    return s;
+}
+
+/**
+ * @brief _QuickTwoSum s + e = a + b exactly, requires |a| >= |b|
+ */
+inline double _QuickTwoSum(double a, double b, double& e) {
+    const double s = a + b;
+    e = b - (s - a);
+    return s;
+}
+
+/**
+ * @brief _SplitValue hi + lo = value exactly for integers up to 64 bit and floating point types up to double (lo = 0),
+ * only 'long double' values are rounded to 106 bit
+ */
+template <typename _Type> double _SplitValue(_Type value, double& lo, std::true_type /* integer */, std::false_type) {
+    // the high 32 bits and the non negative low 32 bits are exact doubles, their sum is exact in hi + lo
+    using _Wide = typename std::conditional<std::is_signed<_Type>::value, int64_t, uint64_t>::type;
+    const _Wide wide = _Wide(value);
+    const _Wide low = _Wide(uint64_t(wide) & 0xffffffffu);
+    return _TwoSum(double((wide - low) / _Wide(4294967296u)) * 4294967296.0, double(low), lo);
+}
+template <typename _Type> double _SplitValue(_Type value, double& lo, std::false_type, std::false_type /* <= double */) {
+    lo = 0.0;
+    return double(value);
+}
+template <typename _Type> double _SplitValue(_Type value, double& lo, std::false_type, std::true_type /* long double */) {
+    const double hi = double(value);
+    lo = std::isfinite(hi) ? double(value - _Type(hi)) : 0.0;
+    return hi;
+}
+template <typename _Type> double _SplitValue(_Type value, double& lo) {
+    using _LongDouble = std::integral_constant<bool, std::is_floating_point<_Type>::value && (sizeof(_Type) > sizeof(double))>;
+    return _SplitValue(value, lo, std::is_integral<_Type>(), _LongDouble());
+}
+
+/**
+ * @brief _TwoProd p + e = a * b exactly, a fused multiply add if the hardware provides it, Dekker's splitting otherwise
+ */
+inline double _TwoProd(double a, double b, double& e) {
+    const double p = a * b;
+#ifdef FP_FAST_FMA
+    e = std::fma(a, b, -p);
+#else
+    constexpr const double SPLITTER = 134217729.0; // 2^27 + 1
+    const double ta = SPLITTER * a, tb = SPLITTER * b;
+    const double aHi = ta - (ta - a), bHi = tb - (tb - b);
+    const double aLo = a - aHi, bLo = b - bHi;
+    e = ((aHi * bHi - p) + aHi * bLo + aLo * bHi) + aLo * bLo;
+#endif
+    return p;
+}
+
+/**
+ * @brief _ThreeSum a + b + c = a' + b' + c' (a' is the rounded sum)
+ */
+inline void _ThreeSum(double& a, double& b, double& c) {
+    double t2, t3;
+    const double t1 = _TwoSum(a, b, t2);
+    a = _TwoSum(c, t1, t3);
+    b = _TwoSum(t2, t3, c);
+}
+
+/**
+ * @brief _ThreeSum2 a + b + c ~ a' + b' (the error of b' is dropped)
+ */
+inline void _ThreeSum2(double& a, double& b, double c) {
+    double t2, t3;
+    const double t1 = _TwoSum(a, b, t2);
+    a = _TwoSum(c, t1, t3);
+    b = t2 + t3;
+}
+
+/**
+ * @brief _Renormalize Turns five overlapping components into four (almost) non overlapping ones (c0 >> c1 >> c2 >> c3)
+ *
+ * two branch free sweeps: bottom up to collect the errors, top down to propagate them (a quick two sum with a zero
+ * first operand is exact as well, the zero tests of the reference implementation are not required)
+ */
+inline void _Renormalize(double& c0, double& c1, double& c2, double& c3, double c4) {
+    double s = _QuickTwoSum(c3, c4, c4);
+    s = _QuickTwoSum(c2, s, c3);
+    s = _QuickTwoSum(c1, s, c2);
+    c0 = _QuickTwoSum(c0, s, c1);
+
+    c0 = _QuickTwoSum(c0, c1, c1);
+    c1 = _QuickTwoSum(c1, c2, c2);
+    c2 = _QuickTwoSum(c2, c3, c3);
+    c3 += c4;
+}
+
+/**
+ * @brief _ParseDecimal Parses a decimal number like "-1.25e-3" (used by DoubleDouble/QuadDouble::FromString)
+ */
+template <typename _Real> _Real _ParseDecimal(const std::string& decimal, const char* function) {
+    auto fail = [&]() {
+        return std::runtime_error("Error: invalid decimal number \"" + decimal + R"(" in function ")" + function + "\"");
+    };
+
+    std::size_t pos = 0;
+    bool negative = false;
+    if (pos < decimal.size() && (decimal[pos] == '-' || decimal[pos] == '+'))
+        negative = decimal[pos++] == '-';
+
+    // digits are accumulated exactly as long as they fit into the precision
+    _Real value(0.0);
+    int exponent = 0, numDigits = 0;
+    bool point = false;
+    for (; pos < decimal.size() && decimal[pos] != 'e' && decimal[pos] != 'E'; ++pos) {
+        const char c = decimal[pos];
+        if (c >= '0' && c <= '9') {
+            value = value * 10.0 + double(c - '0');
+            exponent -= point;
+            ++numDigits;
+        } else if (c == '.' && !point)
+            point = true;
+        else
+            throw fail();
+    }
+    if (!numDigits)
+        throw fail();
+    if (pos < decimal.size()) {
+        try {
+            std::size_t length;
+            exponent += std::stoi(decimal.substr(pos + 1), &length);
+            if (pos + 1 + length != decimal.size())
+                throw fail();
+        } catch (const std::logic_error&) {
+            throw fail();
+        }
+    }
+
+    _Real power(1.0);
+    for (int i = 0; i < std::abs(exponent); ++i)
+        power *= 10.0;
+    value = exponent < 0 ? value / power : value * power;
+    return negative ? -value : value;
+}
+
+/**
+ * @brief _PrintDecimal Writes 'os.precision()' significant digits in scientific notation (trailing zeros are omitted)
+ */
+template <typename _Real> std::ostream& _PrintDecimal(std::ostream& os, const _Real& number) {
+    _Real value = number;
+    const double leading = double(value);
+    if (leading == 0.0 || !std::isfinite(leading))
+        return os << leading;
+    if (leading < 0.0) {
+        os << '-';
+        value = -value;
+    }
+
+    // scale into [1, 10), the estimated exponent may be off by one
+    int exponent = int(std::floor(std::log10(std::abs(leading))));
+    _Real power(1.0);
+    for (int i = 0; i < std::abs(exponent); ++i)
+        power *= 10.0;
+    value = exponent < 0 ? value * power : value / power;
+    if (double(value) >= 10.0) {
+        value = value / 10.0;
+        ++exponent;
+    } else if (double(value) < 1.0) {
+        value = value * 10.0;
+        --exponent;
+    }
+
+    std::string digits;
+    for (int i = 0; i < std::max<int>(1, int(os.precision())); ++i) {
+        const int digit = std::min(9, std::max(0, int(std::floor(double(value)))));
+        digits.push_back(char('0' + digit));
+        value = (value - double(digit)) * 10.0;
+    }
+    digits.erase(digits.find_last_not_of('0') + 1);
+    os << digits[0];
+    if (digits.size() > 1)
+        os << '.' << digits.substr(1);
+    if (exponent)
+        os << 'e' << exponent;
+    return os;
+}
+} // namespace internal
+
+/**
+ * @brief The DoubleDouble struct unevaluated sum of two doubles hi + lo with |lo| <= ulp(hi) / 2 (106 bit mantissa)
+ *
+ * the arithmetic is based on error free transformations (fused multiply add for products if available), it is about
+ * an order of magnitude faster than software floating point types and far more precise than x87 'long double',
+ * the type is trivially copyable and aligned to 16 bytes, arrays of DoubleDouble are vectorization friendly
+ *
+ * usable as '_ValueType' of cf::Vec3 and cf::MultiVector (see PointVector_dd and ddMultiVector), the exponent range
+ * is the one of double
+ */
+struct alignas(16) DoubleDouble {
+    double hi;
+    double lo;
+
+    DoubleDouble() : hi(0.0), lo(0.0) {}
+    DoubleDouble(double high, double low) : hi(internal::_QuickTwoSum(high, low, this->lo)) {}
+
+    /**
+     * @brief DoubleDouble Conversion from any arithmetic type (integers up to 64 bit are converted exactly)
+     */
+    template <typename _Type, typename = typename std::enable_if<std::is_arithmetic<_Type>::value>::type>
+    DoubleDouble(_Type value) : hi(internal::_SplitValue(value, this->lo)) {}
+
+    /**
+     * @brief FromString Parses a decimal number like "-0.743643887037158704752191506114774"
+     */
+    static DoubleDouble FromString(const std::string& decimal) {
+        return internal::_ParseDecimal<DoubleDouble>(decimal, "DoubleDouble::FromString");
+    }
+
+    explicit operator double() const { return this->hi; }
+    explicit operator float() const { return float(this->hi); }
+    explicit operator long double() const { return (long double)(this->hi) + (long double)(this->lo); }
+
+    DoubleDouble operator-() const { return {-this->hi, -this->lo}; }
+
+    friend DoubleDouble operator+(const DoubleDouble& a, const DoubleDouble& b) {
+        double e, f;
+        double s = internal::_TwoSum(a.hi, b.hi, e);
+        const double t = internal::_TwoSum(a.lo, b.lo, f);
+        e += t;
+        s = internal::_QuickTwoSum(s, e, e);
+        e += f;
+        DoubleDouble result;
+        result.hi = internal::_QuickTwoSum(s, e, result.lo);
+        return result;
+    }
+    friend DoubleDouble operator-(const DoubleDouble& a, const DoubleDouble& b) { return a + (-b); }
+
+    friend DoubleDouble operator*(const DoubleDouble& a, const DoubleDouble& b) {
+        double e;
+        const double p = internal::_TwoProd(a.hi, b.hi, e);
+        e += a.hi * b.lo + a.lo * b.hi;
+        DoubleDouble result;
+        result.hi = internal::_QuickTwoSum(p, e, result.lo);
+        return result;
+    }
+
+    /**
+     * @brief operator* Product with a double (cheaper than the general product, exact for powers of two)
+     */
+    friend DoubleDouble operator*(const DoubleDouble& a, double b) {
+        double e;
+        const double p = internal::_TwoProd(a.hi, b, e);
+        e += a.lo * b;
+        DoubleDouble result;
+        result.hi = internal::_QuickTwoSum(p, e, result.lo);
+        return result;
+    }
+    friend DoubleDouble operator*(double a, const DoubleDouble& b) { return b * a; }
+
+    friend DoubleDouble operator/(const DoubleDouble& a, const DoubleDouble& b) {
+        // long division: three quotient digits
+        const double q1 = a.hi / b.hi;
+        DoubleDouble r = a - b * q1;
+        double q2 = r.hi / b.hi;
+        r = r - b * q2;
+        const double q3 = r.hi / b.hi;
+        DoubleDouble result;
+        result.hi = internal::_QuickTwoSum(q1, q2, q2);
+        result.lo = q2;
+        return result + DoubleDouble(q3);
+    }
+
+    DoubleDouble& operator+=(const DoubleDouble& rhs) { return *this = *this + rhs; }
+    DoubleDouble& operator-=(const DoubleDouble& rhs) { return *this = *this - rhs; }
+    DoubleDouble& operator*=(const DoubleDouble& rhs) { return *this = *this * rhs; }
+    DoubleDouble& operator/=(const DoubleDouble& rhs) { return *this = *this / rhs; }
+
+    friend bool operator==(const DoubleDouble& a, const DoubleDouble& b) { return a.hi == b.hi && a.lo == b.lo; }
+    friend bool operator!=(const DoubleDouble& a, const DoubleDouble& b) { return !(a == b); }
+    friend bool operator<(const DoubleDouble& a, const DoubleDouble& b) { return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo); }
+    friend bool operator>(const DoubleDouble& a, const DoubleDouble& b) { return b < a; }
+    friend bool operator<=(const DoubleDouble& a, const DoubleDouble& b) { return !(b < a); }
+    friend bool operator>=(const DoubleDouble& a, const DoubleDouble& b) { return !(a < b); }
+
+    // found by argument dependent lookup (e.g. 'using std::abs; abs(value)' in generic code)
+    friend DoubleDouble abs(const DoubleDouble& a) { return a.hi < 0.0 ? -a : a; }
+    friend DoubleDouble sqrt(const DoubleDouble& a) {
+        if (a.hi <= 0.0)
+            return a.hi == 0.0 ? DoubleDouble() : DoubleDouble(std::sqrt(a.hi));
+
+        // one Newton step from the double precision root: x + (a - x^2) / (2 * x)
+        const double x = std::sqrt(a.hi);
+        double e;
+        const double x2 = internal::_TwoProd(x, x, e);
+        const DoubleDouble r = a - DoubleDouble(x2, e);
+        return DoubleDouble(x, r.hi * 0.5 / x);
+    }
+    friend bool isfinite(const DoubleDouble& a) { return std::isfinite(a.hi); }
+
+    friend std::ostream& operator<<(std::ostream& os, const DoubleDouble& a) { return internal::_PrintDecimal(os, a); }
+};
+
+/**
+ * @brief The QuadDouble struct unevaluated sum of four doubles (212 bit mantissa), see DoubleDouble
+ *
+ * additions and products are the "sloppy" variants of Hida, Li and Bailey (relative error of a few ulp of the
+ * 212 bit mantissa), every operation ends with a renormalization of the components
+ */
+struct alignas(16) QuadDouble {
+    double c[4];
+
+    QuadDouble() : c{0.0, 0.0, 0.0, 0.0} {}
+    QuadDouble(double c0, double c1, double c2, double c3) : c{c0, c1, c2, c3} {
+        internal::_Renormalize(this->c[0], this->c[1], this->c[2], this->c[3], 0.0);
+    }
+    QuadDouble(const DoubleDouble& value) : c{value.hi, value.lo, 0.0, 0.0} {}
+
+    /**
+     * @brief QuadDouble Conversion from any arithmetic type (integers up to 64 bit are converted exactly)
+     */
+    template <typename _Type, typename = typename std::enable_if<std::is_arithmetic<_Type>::value>::type>
+    QuadDouble(_Type value) : c{0.0, 0.0, 0.0, 0.0} {
+        this->c[0] = internal::_SplitValue(value, this->c[1]);
+    }
+
+    /**
+     * @brief FromString Parses a decimal number like "-0.743643887037158704752191506114774"
+     */
+    static QuadDouble FromString(const std::string& decimal) {
+        return internal::_ParseDecimal<QuadDouble>(decimal, "QuadDouble::FromString");
+    }
+
+    explicit operator double() const { return this->c[0]; }
+    explicit operator float() const { return float(this->c[0]); }
+    explicit operator long double() const { return (long double)(this->c[0]) + (long double)(this->c[1]); }
+    explicit operator DoubleDouble() const { return {this->c[0], this->c[1] + this->c[2]}; }
+
+    QuadDouble operator-() const {
+        QuadDouble result;
+        for (int i = 0; i < 4; ++i)
+            result.c[i] = -this->c[i];
+        return result;
+    }
+
+    friend QuadDouble operator+(const QuadDouble& a, const QuadDouble& b) {
+        double t0, t1, t2, t3;
+        double s0 = internal::_TwoSum(a.c[0], b.c[0], t0);
+        double s1 = internal::_TwoSum(a.c[1], b.c[1], t1);
+        double s2 = internal::_TwoSum(a.c[2], b.c[2], t2);
+        double s3 = internal::_TwoSum(a.c[3], b.c[3], t3);
+
+        s1 = internal::_TwoSum(s1, t0, t0);
+        internal::_ThreeSum(s2, t0, t1);
+        internal::_ThreeSum2(s3, t0, t2);
+        t0 = t0 + t1 + t3;
+
+        internal::_Renormalize(s0, s1, s2, s3, t0);
+        QuadDouble result;
+        result.c[0] = s0;
+        result.c[1] = s1;
+        result.c[2] = s2;
+        result.c[3] = s3;
+        return result;
+    }
+    friend QuadDouble operator-(const QuadDouble& a, const QuadDouble& b) { return a + (-b); }
+
+    friend QuadDouble operator*(const QuadDouble& a, const QuadDouble& b) {
+        // all products of order < 3 exactly, products of order 3 in double precision
+        double q0, q1, q2, q3, q4, q5, t0, t1;
+        double p0 = internal::_TwoProd(a.c[0], b.c[0], q0);
+        double p1 = internal::_TwoProd(a.c[0], b.c[1], q1);
+        double p2 = internal::_TwoProd(a.c[1], b.c[0], q2);
+        double p3 = internal::_TwoProd(a.c[0], b.c[2], q3);
+        double p4 = internal::_TwoProd(a.c[1], b.c[1], q4);
+        double p5 = internal::_TwoProd(a.c[2], b.c[0], q5);
+
+        internal::_ThreeSum(p1, p2, q0);
+        internal::_ThreeSum(p2, q1, q2);
+        internal::_ThreeSum(p3, p4, p5);
+        double s0 = internal::_TwoSum(p2, p3, t0);
+        double s1 = internal::_TwoSum(q1, p4, t1);
+        double s2 = q2 + p5;
+        s1 = internal::_TwoSum(s1, t0, t0);
+        s2 += t0 + t1;
+        s1 += a.c[0] * b.c[3] + a.c[1] * b.c[2] + a.c[2] * b.c[1] + a.c[3] * b.c[0] + q0 + q3 + q4 + q5;
+
+        internal::_Renormalize(p0, p1, s0, s1, s2);
+        QuadDouble result;
+        result.c[0] = p0;
+        result.c[1] = p1;
+        result.c[2] = s0;
+        result.c[3] = s1;
+        return result;
+    }
+
+    friend QuadDouble operator/(const QuadDouble& a, const QuadDouble& b) {
+        // long division: five quotient digits
+        double q[5];
+        QuadDouble r = a;
+        for (int i = 0; i < 4; ++i) {
+            q[i] = r.c[0] / b.c[0];
+            r = r - b * QuadDouble(q[i]);
+        }
+        q[4] = r.c[0] / b.c[0];
+        internal::_Renormalize(q[0], q[1], q[2], q[3], q[4]);
+        QuadDouble result;
+        for (int i = 0; i < 4; ++i)
+            result.c[i] = q[i];
+        return result;
+    }
+
+    QuadDouble& operator+=(const QuadDouble& rhs) { return *this = *this + rhs; }
+    QuadDouble& operator-=(const QuadDouble& rhs) { return *this = *this - rhs; }
+    QuadDouble& operator*=(const QuadDouble& rhs) { return *this = *this * rhs; }
+    QuadDouble& operator/=(const QuadDouble& rhs) { return *this = *this / rhs; }
+
+    friend bool operator==(const QuadDouble& a, const QuadDouble& b) {
+        return a.c[0] == b.c[0] && a.c[1] == b.c[1] && a.c[2] == b.c[2] && a.c[3] == b.c[3];
+    }
+    friend bool operator!=(const QuadDouble& a, const QuadDouble& b) { return !(a == b); }
+    friend bool operator<(const QuadDouble& a, const QuadDouble& b) {
+        for (int i = 0; i < 4; ++i) {
+            if (a.c[i] != b.c[i])
+                return a.c[i] < b.c[i];
+        }
+        return false;
+    }
+    friend bool operator>(const QuadDouble& a, const QuadDouble& b) { return b < a; }
+    friend bool operator<=(const QuadDouble& a, const QuadDouble& b) { return !(b < a); }
+    friend bool operator>=(const QuadDouble& a, const QuadDouble& b) { return !(a < b); }
+
+    friend QuadDouble abs(const QuadDouble& a) { return a.c[0] < 0.0 ? -a : a; }
+    friend QuadDouble sqrt(const QuadDouble& a) {
+        if (a.c[0] <= 0.0)
+            return a.c[0] == 0.0 ? QuadDouble() : QuadDouble(std::sqrt(a.c[0]));
+
+        // Newton steps x' = x + (a - x^2) / (2 * x), every step doubles the number of correct bits
+        QuadDouble x(std::sqrt(a.c[0]));
+        for (int i = 0; i < 3; ++i)
+            x += (a - x * x) / (x * 2.0);
+        return x;
+    }
+    friend bool isfinite(const QuadDouble& a) { return std::isfinite(a.c[0]); }
+
+    friend std::ostream& operator<<(std::ostream& os, const QuadDouble& a) { return internal::_PrintDecimal(os, a); }
+};
+} // namespace cf
+
+namespace std {
+template <> class numeric_limits<cf::DoubleDouble> : public numeric_limits<double> {
+  public:
+    static constexpr const int digits = 106;
+    static constexpr const int digits10 = 31;
+    static cf::DoubleDouble epsilon() { return cf::DoubleDouble(4.93038065763132e-32); } // 2^-104
+};
+template <> class numeric_limits<cf::QuadDouble> : public numeric_limits<double> {
+  public:
+    static constexpr const int digits = 212;
+    static constexpr const int digits10 = 62;
+    static cf::QuadDouble epsilon() { return cf::QuadDouble(1.21543267145725e-63); } // 2^-209
+};
+} // namespace std
+
+#endif // MULTI_PRECISION_H_H
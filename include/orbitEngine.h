@@ -0,0 +1,208 @@
+#ifndef ORBIT_ENGINE_H_H
+#define ORBIT_ENGINE_H_H
+
+#include "ORB.h"
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace cf {
+
+/**
+ * @brief The OrbitMap struct evaluates the ten factor map described by *.orb files
+ *
+ * with the factors a - j (see cf::Orbit::getAllFactors) one iteration is defined as: \n
+ \verbatim
+ x' = a + b * y + c * |x| + d * x^2 + e * x * y + f * sign(x) * sqrt(|g * x - h|)
+ y' = i + j * x
+ \endverbatim
+ * with sign(0) = 1, this covers the Henon, Lozi, Gingerbreadman and Martin (hopalong) families of the provided files
+ */
+struct OrbitMap {
+    static constexpr const std::size_t NUM_FACTORS = 10;
+
+    OrbitMap() { this->factors.fill(0.0); }
+    OrbitMap(const cf::Orbit& orbit);
+    OrbitMap(const std::vector<float>& factorList);
+
+    std::array<double, NUM_FACTORS> factors;
+
+    /**
+     * @brief operator() Calculates the next orbit point
+     * @param p Current point
+     * @return Next point
+     */
+    glm::dvec2 operator()(const glm::dvec2& p) const { return OrbitMap::Evaluate(this->factors, p); }
+
+    /**
+     * @brief jacobian Analytic derivatives of the map (column major, first column: derivatives by x)
+     * @param p Current point
+     * @return Jacobian matrix at p
+     */
+    glm::dmat2 jacobian(const glm::dvec2& p) const { return OrbitMap::Jacobian(this->factors, p); }
+
+    /**
+     * @brief Evaluate Map kernel, '_Factors' may be any type offering 'double operator[](std::size_t)'
+     */
+    template <typename _Factors> static glm::dvec2 Evaluate(const _Factors& f, const glm::dvec2& p) {
+        const double sign = p.x < 0.0 ? -1.0 : 1.0;
+        return {f[0] + f[1] * p.y + f[2] * std::abs(p.x) + f[3] * p.x * p.x + f[4] * p.x * p.y +
+                    f[5] * sign * std::sqrt(std::abs(f[6] * p.x - f[7])),
+                f[8] + f[9] * p.x};
+    }
+
+    /**
+     * @brief Jacobian Derivative kernel, see 'Evaluate'
+     */
+    template <typename _Factors> static glm::dmat2 Jacobian(const _Factors& f, const glm::dvec2& p) {
+        const double sign = p.x < 0.0 ? -1.0 : 1.0;
+        const double root = f[6] * p.x - f[7];
+        const double rootSign = root < 0.0 ? -1.0 : 1.0;
+        const double rootDerivative = f[5] == 0.0 ? 0.0 : f[5] * sign * rootSign * f[6] / (2.0 * std::sqrt(std::abs(root)));
+
+        const double dxdx = f[2] * sign + 2.0 * f[3] * p.x + f[4] * p.y + rootDerivative;
+        const double dxdy = f[1] + f[4] * p.x;
+        return glm::dmat2(dxdx, f[9], dxdy, 0.0);
+    }
+};
+
+/**
+ * @brief The OrbitEngine struct iterates an orbit and passes every calculated point to a callback
+ *
+ * optionally a Brent cycle detection compares the orbit points within a tolerance, so orbits collapsing onto
+ * fixed points or short cycles either stop early or replay the found cycle instead of evaluating the map again
+ */
+struct OrbitEngine {
+    enum class CycleHandling {
+        DISABLED /* iterate the full budget */,
+        STOP /* stop as soon as a cycle has been detected */,
+        REPLAY /* store the cycle once and replay it for the remaining iterations */
+    };
+
+    struct Result {
+        std::size_t iterations = 0;  /* number of points passed to the callback */
+        std::size_t evaluations = 0; /* number of map evaluations */
+        std::size_t transientLength = 0;
+        std::size_t period = 0; /* 0 -> no cycle detected */
+        bool diverged = false;
+    };
+
+    OrbitEngine(const cf::OrbitMap& map = cf::OrbitMap());
+    OrbitEngine(const cf::Orbit& orbit);
+
+    /**
+     * @brief setCycleDetection Enables/disables the cycle detection
+     * @param handling Behaviour after a cycle has been detected
+     * @param tolerance Two points are equal if both coordinates differ less than 'tolerance'
+     * @param maxReplayPeriod Cycles with a longer period will be iterated normally (REPLAY only)
+     */
+    void setCycleDetection(CycleHandling handling, double tolerance = 1e-9, std::size_t maxReplayPeriod = 1 << 16);
+    CycleHandling getCycleHandling() const;
+    double getCycleTolerance() const;
+
+    cf::OrbitMap& getMap();
+    const cf::OrbitMap& getMap() const;
+
+    /**
+     * @brief iterate Iterates the orbit
+     * @param start Starting point (iteration 0, will not be passed to the callback)
+     * @param numIterations Iteration budget
+     * @param callback Function with signature 'void(const glm::dvec2& point, std::size_t iteration)', callbacks returning
+     * bool instead of void stop the iteration by returning false
+     * @return Iteration statistics (period and transient length if a cycle has been detected)
+     */
+    template <typename _Callback>
+    Result iterate(const glm::dvec2& start, std::size_t numIterations, _Callback&& callback) const {
+        Result result;
+        const bool detectCycles = this->m_CycleHandling != CycleHandling::DISABLED;
+
+        // brent's algorithm, 'tortoise' will be moved to the current point each power of two
+        glm::dvec2 tortoise = start;
+        std::size_t power = 1;
+        std::size_t lambda = 0;
+
+        glm::dvec2 p = start;
+        while (result.iterations < numIterations) {
+            p = this->m_Map(p);
+            ++result.evaluations;
+            if (!std::isfinite(p.x) || !std::isfinite(p.y)) {
+                result.diverged = true;
+                return result;
+            }
+            ++result.iterations;
+            if (!OrbitEngine::_Invoke(callback, p, result.iterations))
+                return result;
+
+            if (!detectCycles)
+                continue;
+
+            ++lambda;
+            if (this->_equal(p, tortoise)) {
+                result.period = lambda;
+                break;
+            }
+            if (lambda == power) {
+                tortoise = p;
+                power <<= 1;
+                lambda = 0;
+            }
+        }
+        if (!result.period)
+            return result;
+
+        this->_calculateTransientLength(start, result);
+        if (this->m_CycleHandling == CycleHandling::STOP || result.period > this->m_MaxReplayPeriod)
+            return result;
+
+        // store one cycle and replay it
+        std::vector<glm::dvec2> cycle;
+        cycle.reserve(result.period);
+        while (cycle.size() < result.period && result.iterations < numIterations) {
+            p = this->m_Map(p);
+            ++result.evaluations;
+            ++result.iterations;
+            cycle.push_back(p);
+            if (!OrbitEngine::_Invoke(callback, p, result.iterations))
+                return result;
+        }
+        for (std::size_t idx = 0; result.iterations < numIterations; idx = (idx + 1 == cycle.size() ? 0 : idx + 1)) {
+            ++result.iterations;
+            if (!OrbitEngine::_Invoke(callback, cycle[idx], result.iterations))
+                return result;
+        }
+        return result;
+    }
+
+    /**
+     * @brief iterate Iterates the orbit without callback (e.g. for period/transient detection only)
+     */
+    Result iterate(const glm::dvec2& start, std::size_t numIterations) const;
+
+  private:
+    template <typename _Callback>
+    static auto _Invoke(_Callback& callback, const glm::dvec2& p, std::size_t iteration) ->
+        typename std::enable_if<std::is_same<decltype(callback(p, iteration)), bool>::value, bool>::type {
+        return callback(p, iteration);
+    }
+    template <typename _Callback>
+    static auto _Invoke(_Callback& callback, const glm::dvec2& p, std::size_t iteration) ->
+        typename std::enable_if<!std::is_same<decltype(callback(p, iteration)), bool>::value, bool>::type {
+        callback(p, iteration);
+        return true;
+    }
+
+    bool _equal(const glm::dvec2& p1, const glm::dvec2& p2) const {
+        return std::abs(p1.x - p2.x) < this->m_CycleTolerance && std::abs(p1.y - p2.y) < this->m_CycleTolerance;
+    }
+    void _calculateTransientLength(const glm::dvec2& start, Result& result) const;
+
+    cf::OrbitMap m_Map;
+    CycleHandling m_CycleHandling = CycleHandling::DISABLED;
+    double m_CycleTolerance = 1e-9;
+    std::size_t m_MaxReplayPeriod = 1 << 16;
+};
+} // namespace cf
+
+#endif // ORBIT_ENGINE_H_H
@@ -0,0 +1,160 @@
+#ifndef ORBIT_STREAM_H_H
+#define ORBIT_STREAM_H_H
+
+#include "densityCanvas.h"
+#include "orbitEngine.h"
+
+#include <cstdint>
+#include <fstream>
+
+namespace cf {
+
+namespace internal {
+inline uint64_t _ZigZag(int64_t v) { return (uint64_t(v) << 1) ^ uint64_t(v >> 63); }
+inline int64_t _UnZigZag(uint64_t v) { return int64_t(v >> 1) ^ -int64_t(v & 1); }
+
+// reads one varint of the bytes [data, end), a varint beyond 'end' or longer than 64 bits is corrupt
+inline uint64_t _ReadVarint(const uint8_t*& data, const uint8_t* end) {
+    uint64_t v = 0;
+    for (int shift = 0;; shift += 7) {
+        if (data == end || shift > 63)
+            throw std::runtime_error(R"(Error: corrupt orbit stream chunk in function "internal::_ReadVarint")");
+        const uint8_t byte = *data++;
+        v |= uint64_t(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return v;
+    }
+}
+
+// chunk index entry, every field is stored as little endian uint64
+struct _OrbitChunkInfo {
+    uint64_t offset;
+    uint64_t numRecords;
+    uint64_t firstIteration;
+    uint64_t lastIteration;
+};
+} // namespace internal
+
+/**
+ * @brief The OrbitRecorder struct writes orbit points into a compact binary stream (see cf::OrbitStream)
+ *
+ * the coordinates are quantized onto a grid with spacing 'resolution', every record (x, y, iteration) is stored as
+ * zigzag varint delta to its predecessor, mostly resulting in 2 - 6 bytes per record,
+ * records are grouped into chunks (delta encoding restarts with every chunk), a chunk index is appended on close
+ *
+ * the recorder can be passed directly as callback to cf::OrbitEngine::iterate (by std::ref),
+ * non finite points will not be recorded
+ */
+struct OrbitRecorder {
+    static constexpr const std::size_t CHUNK_RECORDS = 1 << 16;
+
+    /**
+     * @brief OrbitRecorder Opens/overwrites the file
+     * @param resolution Quantization step of the coordinates, should be smaller than the pixel size of all
+     * framings the stream will be replayed into
+     * @param origin Origin of the quantization grid, e.g. the center of the attractor
+     */
+    OrbitRecorder(const std::string& path, double resolution = 1e-6, const glm::dvec2& origin = glm::dvec2(0.0));
+    OrbitRecorder(const OrbitRecorder&) = delete;
+    OrbitRecorder& operator=(const OrbitRecorder&) = delete;
+    ~OrbitRecorder();
+
+    void record(const glm::dvec2& point, std::size_t iteration);
+    void operator()(const glm::dvec2& point, std::size_t iteration) { this->record(point, iteration); }
+
+    /**
+     * @brief close Writes the last chunk and the chunk index, further records are not allowed
+     */
+    void close();
+
+    std::size_t getNumRecords() const;
+
+  private:
+    void _flushChunk();
+
+    std::ofstream m_File;
+    double m_Resolution;
+    glm::dvec2 m_Origin;
+
+    std::vector<uint8_t> m_Buffer; // current chunk
+    std::vector<internal::_OrbitChunkInfo> m_Chunks;
+    internal::_OrbitChunkInfo m_Current = {0, 0, 0, 0};
+    int64_t m_LastX = 0;
+    int64_t m_LastY = 0;
+    uint64_t m_LastIteration = 0;
+    std::size_t m_NumRecords = 0;
+};
+
+/**
+ * @brief The OrbitStream struct replays a stream written by cf::OrbitRecorder
+ *
+ * the file is memory mapped (read only), records are decoded straight from the mapping,
+ * chunks are replayed in parallel, the chunk index allows to skip chunks outside of a requested iteration range
+ */
+struct OrbitStream {
+    struct Record {
+        glm::dvec2 point;
+        uint64_t iteration;
+    };
+
+    OrbitStream(const std::string& path);
+    OrbitStream(const OrbitStream&) = delete;
+    OrbitStream& operator=(const OrbitStream&) = delete;
+    ~OrbitStream();
+
+    std::size_t getNumRecords() const;
+    std::size_t getNumChunks() const;
+    double getResolution() const;
+
+    /**
+     * @brief forEach Calls 'function(const Record&)' for every record in order
+     */
+    template <typename _Function> void forEach(_Function&& function) const {
+        for (std::size_t chunk = 0; chunk < this->m_Chunks.size(); ++chunk)
+            this->_decodeChunk(chunk, function);
+    }
+
+    /**
+     * @brief replay Adds all records with an iteration within [firstIteration, lastIteration] to the canvas
+     */
+    void replay(cf::DensityCanvas& canvas, uint64_t firstIteration = 0, uint64_t lastIteration = UINT64_MAX) const;
+    void setNumThreads(unsigned numThreads);
+
+  private:
+    void _unmap();
+    template <typename _Function> void _decodeChunk(std::size_t chunk, _Function&& function) const;
+
+    const uint8_t* m_Data = nullptr;
+    std::size_t m_Size = 0;
+    void* m_Handle = nullptr; // platform specific mapping handle
+
+    double m_Resolution = 1.0;
+    glm::dvec2 m_Origin = glm::dvec2(0.0);
+    std::vector<internal::_OrbitChunkInfo> m_Chunks;
+    uint64_t m_IndexOffset = 0; // end of the last chunk
+    std::size_t m_NumRecords = 0;
+    unsigned m_NumThreads = 0;
+};
+
+template <typename _Function> void OrbitStream::_decodeChunk(std::size_t chunk, _Function&& function) const {
+    const internal::_OrbitChunkInfo& info = this->m_Chunks[chunk];
+    const uint8_t* data = this->m_Data + info.offset;
+    const uint8_t* end =
+        this->m_Data + (chunk + 1 < this->m_Chunks.size() ? this->m_Chunks[chunk + 1].offset : this->m_IndexOffset);
+
+    int64_t x = 0, y = 0;
+    uint64_t iteration = 0;
+    Record record;
+    for (uint64_t i = 0; i < info.numRecords; ++i) {
+        x += internal::_UnZigZag(internal::_ReadVarint(data, end));
+        y += internal::_UnZigZag(internal::_ReadVarint(data, end));
+        iteration += internal::_UnZigZag(internal::_ReadVarint(data, end));
+        record.point = glm::dvec2(this->m_Origin.x + double(x) * this->m_Resolution,
+                                  this->m_Origin.y + double(y) * this->m_Resolution);
+        record.iteration = iteration;
+        function(record);
+    }
+}
+} // namespace cf
+
+#endif // ORBIT_STREAM_H_H
@@ -0,0 +1,93 @@
+#ifndef PROGRESSIVE_RENDERER_H_H
+#define PROGRESSIVE_RENDERER_H_H
+
+#include "escapeTime.h"
+
+#include <functional>
+
+namespace cf {
+
+/**
+ * @brief The ProgressiveRenderer struct renders escape time fractals coarse to fine for interactive exploration
+ *
+ * the first pass calculates every 'coarsestStep'-th pixel in both directions and fills the blocks in between,
+ * every further pass halves the step until all pixels are calculated, only not yet known samples are iterated
+ *
+ * the samples of the previous view are kept: pixels of a new view, whose center coincides with a pixel center of the
+ * previous view (pans by whole pixels, zooms by odd integer factors), are reused without iterating them again, all
+ * other pixels within half a pixel of a previous sample (e.g. zooms by 2) are seeded with it, the preview shows the
+ * seeded sample until the pixel is iterated by its pass
+ */
+struct ProgressiveRenderer {
+    /**
+     * @brief Callback Called after every pass with its step (1 -> final image) and the (partially filled) result
+     */
+    using Callback = std::function<void(int step, const cf::EscapeTime::Result& result)>;
+
+    /**
+     * @brief ProgressiveRenderer Constructor
+     * @param palette Color palette (e.g. Mandel.pal), escaped pixels use the entry 'iterations % size'
+     */
+    ProgressiveRenderer(const cf::EscapeTime& fractal, const std::vector<cf::Color>& palette,
+                        const cf::Color& insideColor = cf::Color::BLACK);
+
+    /**
+     * @brief setFractal Replaces the fractal, all samples of the previous view are discarded
+     */
+    void setFractal(const cf::EscapeTime& fractal);
+
+    /**
+     * @brief setCoarsestStep Pixel step of the first pass (power of two, default 16 -> 1/16 resolution preview)
+     */
+    void setCoarsestStep(int step);
+
+    /**
+     * @brief clear Discards all samples of the previous view
+     */
+    void clear();
+
+    /**
+     * @brief calculate Calculates the view pass by pass, returns the final result
+     */
+    const cf::EscapeTime::Result& calculate(int width, int height, const cf::Interval& range_x, const cf::Interval& range_y,
+                                            const Callback& onPass = nullptr);
+
+    /**
+     * @brief render Calculates the window intervals pass by pass, the window is updated after every pass
+     * @param onPass Called after the window was updated (e.g. to show it)
+     */
+    void render(cf::WindowVectorized& window, const std::function<void(int step)>& onPass = nullptr);
+
+    /**
+     * @brief getReusedPixels Number of pixels reused from the previous view by the last calculation
+     */
+    std::size_t getReusedPixels() const;
+
+    /**
+     * @brief getSeededPixels Number of pixels seeded with the nearest sample of the previous view by the last calculation
+     */
+    std::size_t getSeededPixels() const;
+
+  private:
+    /**
+     * @brief _reuse Moves the samples of the previous view to their positions within the new view
+     */
+    void _reuse(int width, int height, double minX, double maxY, double stepX, double stepY);
+
+    cf::EscapeTime m_Fractal;
+    std::vector<cf::Color> m_Palette;
+    cf::Color m_InsideColor;
+    int m_CoarsestStep = 16;
+
+    cf::EscapeTime::Result m_Result;
+    std::vector<uint8_t> m_Known; /* 0 -> unknown, 1 -> iterated, 2 -> seeded by the previous view */
+    double m_MinX = 0.0;
+    double m_MaxY = 0.0;
+    double m_StepX = 0.0;
+    double m_StepY = 0.0;
+    std::size_t m_ReusedPixels = 0;
+    std::size_t m_SeededPixels = 0;
+};
+} // namespace cf
+
+#endif // PROGRESSIVE_RENDERER_H_H
@@ -0,0 +1,181 @@
+#ifndef TURMITE_H_H
+#define TURMITE_H_H
+
+#include "chunkedGrid.h"
+
+#include <array>
+
+namespace cf {
+
+/**
+ * @brief The Turmite struct simulates a (generalized) Langton's ant on a torus or an unbounded grid (cf::ChunkedGrid)
+ *
+ * the rule string has one character per cell state (e.g. "100000111000" from cf::readAntString): the ant turns
+ * right ('1' or 'R') or left ('0' or 'L'), 'N' keeps the direction and 'U' turns around, the state of the cell is
+ * incremented (modulo the number of states) and the ant moves one cell forward
+ *
+ * cells are stored as one byte each (row major), the ant position is a single cell index, one lookup of (direction,
+ * state) yields the new direction and the index offset of the move, the next state comes from a second table, as long as
+ * the ant is farther away from the border (of the torus or of its current chunk) than the remaining steps of a batch the
+ * step loop contains neither branches nor bounds checks
+ *
+ * highways (unbounded grids only): the sequence of (state, direction) of a short recorded run is checked for a periodic
+ * tail, a candidate period is confirmed, if the cells around the ant repeat after one period (translated) and all cells
+ * ahead of the ant are 0, from then on the ant moves by whole periods without simulating them, the cells of the skipped
+ * periods are not stored but derived from the cells around the ant after one period
+ */
+struct Turmite {
+    using AbsoluteDirection = Direction::AbsoluteDirection;
+    static constexpr const int MAX_STATES = 256;
+
+    /**
+     * @brief Turmite Grid of 'width' x 'height' cells (state 0), the ant starts in the center heading north
+     */
+    Turmite(const std::string& rule, int width, int height);
+
+    /**
+     * @brief Turmite Unbounded grid (state 0), the ant starts at the cell (0, 0) heading north
+     */
+    explicit Turmite(const std::string& rule);
+
+    /**
+     * @brief FromFile Reads the rule string of an .ant file (e.g. Ant_10.ant)
+     */
+    static Turmite FromFile(const std::string& filePath, int width, int height);
+    static Turmite FromFile(const std::string& filePath);
+
+    void setPosition(int64_t x, int64_t y, AbsoluteDirection direction = AbsoluteDirection::NORTH);
+    void clear();
+
+    /**
+     * @brief setHighwayDetection Detection and extrapolation of highways on unbounded grids (default on)
+     */
+    void setHighwayDetection(bool enabled);
+
+    /**
+     * @brief getHighway Period (steps) of the highway and translation of the ant per period
+     * @return False, if no highway has been detected (so far)
+     */
+    bool getHighway(uint64_t& period, int64_t& dx, int64_t& dy) const;
+
+    /**
+     * @brief run Simulates 'steps' further steps (on a torus the ant wraps around at the borders)
+     */
+    void run(uint64_t steps);
+
+    uint64_t getSteps() const;
+    int64_t getX() const;
+    int64_t getY() const;
+    AbsoluteDirection getDirection() const;
+    bool isUnbounded() const;
+    int getWidth() const;
+    int getHeight() const;
+    const std::string& getRule() const;
+    int getNumStates() const;
+    uint8_t getState(int64_t x, int64_t y) const;
+
+    /**
+     * @brief getCells Cells of the torus (row major), empty for unbounded grids
+     */
+    const std::vector<uint8_t>& getCells() const;
+
+    /**
+     * @brief getGrid Cells of the unbounded grid, empty for tori (cells of skipped highway periods are not stored, see
+     * getState)
+     */
+    const cf::ChunkedGrid& getGrid() const;
+
+    /**
+     * @brief getBounds Bounding box of all cells with a state != 0 (inclusive), skipped highway periods are included with
+     * the squares around their start cells
+     * @return False, if all cells are 0
+     */
+    bool getBounds(int64_t& minX, int64_t& minY, int64_t& maxX, int64_t& maxY) const;
+
+    /**
+     * @brief getPopulation Number of cells with a state != 0 (including the cells of skipped highway periods)
+     */
+    uint64_t getPopulation() const;
+
+    /**
+     * @brief render Draws the cells with the palette entry of their state (e.g. Chaos_ant.pal) scaled to the window size
+     * (nearest neighbour): the whole torus or the bounding box of all visited cells of the unbounded grid
+     */
+    void render(cf::WindowRasterized& window, const std::vector<cf::Color>& palette) const;
+
+    /**
+     * @brief render Draws the region of 'columns' x 'rows' cells starting at the cell 'minX'/'minY' (top left), cells
+     * outside of a torus are drawn in state 0
+     */
+    void render(cf::WindowRasterized& window, const std::vector<cf::Color>& palette, int64_t minX, int64_t minY,
+                int64_t columns, int64_t rows) const;
+    void render(cv::Mat& image, const std::vector<cf::Color>& palette, int64_t minX, int64_t minY, int64_t columns,
+                int64_t rows) const;
+
+  private:
+    /**
+     * @brief The _Highway struct Periodic motion of the ant: periods 0 ... periods - 1 start at base + k * (dx, dy) and
+     * were skipped, the ant is 'phase' steps beyond the start of the period 'periods'
+     */
+    struct _Highway {
+        uint64_t period = 0; /* 0 -> no highway */
+        int64_t dx = 0;
+        int64_t dy = 0;
+        int radius = 0; /* Chebyshev radius around the start of a period covering all cells the ant visits */
+        int64_t baseX = 0;
+        int64_t baseY = 0;
+        uint64_t periods = 0;
+        uint64_t phase = 0;
+        int direction = 0;          /* direction of the ant at the start of a period */
+        std::vector<uint8_t> start; /* cells around the start of a period (row major, 2 * radius + 1 cells per row) */
+        std::vector<uint8_t> end;   /* the same cells after the period */
+
+        /**
+         * @brief lastPeriod Last skipped period, which visited the cell (x, y) (-1 -> none or the cell belongs to the
+         * grid)
+         */
+        int64_t lastPeriod(int64_t x, int64_t y) const;
+    };
+
+    void _createTables(std::ptrdiff_t rowStride);
+    void _runTorus(uint64_t steps);
+    void _runUnbounded(uint64_t steps);
+    void _runChunked(uint64_t steps);
+    void _runRecorded(uint64_t steps, std::vector<uint16_t>* symbols, std::vector<int64_t>* positions);
+    /**
+     * @brief _findHighway Checks the completed recorded run for a periodic tail, which becomes the highway candidate
+     */
+    bool _findHighway();
+
+    /**
+     * @brief _confirmHighway Checks the candidate after one more simulated period, sets the highway on success
+     */
+    bool _confirmHighway();
+    void _resetHighwayDetection();
+    void _runHighway(uint64_t steps);
+    std::vector<uint8_t> _cellsAround(int64_t x, int64_t y, int radius) const;
+
+    std::string m_Rule;
+    int m_Width = 0; /* 0 -> unbounded */
+    int m_Height = 0;
+    std::vector<uint8_t> m_Cells;
+    cf::ChunkedGrid m_Grid;
+    std::array<uint8_t, MAX_STATES> m_Turn;                   /* state -> clockwise quarter turns */
+    std::array<uint8_t, MAX_STATES> m_NextState;              /* state -> state after the visit */
+    std::array<uint16_t, 4 * MAX_STATES> m_DirectionTable;    /* direction * 256 + state -> new direction * 256 */
+    std::array<std::ptrdiff_t, 4 * MAX_STATES> m_OffsetTable; /* direction * 256 + state -> index offset of the move */
+    int64_t m_X = 0;
+    int64_t m_Y = 0;
+    int m_Direction = 0; /* cf::Direction::AbsoluteDirection, clockwise */
+    uint64_t m_Steps = 0;
+    bool m_HighwayDetection = true;
+    _Highway m_Highway;
+    uint64_t m_UnrecordedSteps = 0;   /* steps since the last recorded run */
+    uint64_t m_DetectionInterval = 0; /* unrecorded steps before the next recorded run */
+    std::vector<uint16_t> m_Symbols;  /* (state, direction) of the current recorded run */
+    std::vector<int64_t> m_Positions; /* ant positions (x, y) of the current recorded run */
+    _Highway m_Candidate;             /* highway found in the recorded run, 'phase' steps of its confirmation are done */
+};
+} // namespace cf
+
+#endif // TURMITE_H_H
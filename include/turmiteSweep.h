@@ -0,0 +1,112 @@
+#ifndef TURMITE_SWEEP_H_H
+#define TURMITE_SWEEP_H_H
+
+#include "turmite.h"
+
+#include <functional>
+
+namespace cf {
+
+/**
+ * @brief The TurmiteSweep struct runs many independent turmites (rule strings or .ant files) on unbounded grids and
+ * summarizes their behaviour
+ *
+ * every rule runs for the same step budget, the runs are distributed over a thread pool (one turmite per thread at a
+ * time, the largest memory footprint is numThreads grids), thumbnails are rendered by the simulating threads and handed
+ * to a writer thread through a bounded queue, so slow image encoding does not stall the simulations
+ */
+struct TurmiteSweep {
+    struct Result {
+        std::string name; /* file name without extension or the rule string */
+        std::string rule;
+        uint64_t steps = 0;
+        bool empty = true; /* all cells 0, the bounding box is invalid */
+        int64_t minX = 0;  /* bounding box of all cells with a state != 0 (inclusive) */
+        int64_t minY = 0;
+        int64_t maxX = 0;
+        int64_t maxY = 0;
+        uint64_t population = 0;    /* number of cells with a state != 0 */
+        uint64_t highwayPeriod = 0; /* 0 -> no highway */
+        int64_t highwayDx = 0;
+        int64_t highwayDy = 0;
+        double seconds = 0.0; /* simulation time */
+    };
+    using ThumbnailCallback = std::function<void(const Result& result, const cv::Mat& image)>;
+
+    TurmiteSweep();
+
+    /**
+     * @brief addRule Adds a rule string (see cf::Turmite), 'name' defaults to the rule string
+     */
+    void addRule(const std::string& rule, const std::string& name = "");
+
+    /**
+     * @brief addFile Adds the rule of an .ant file (e.g. Ant_10.ant)
+     */
+    void addFile(const std::string& filePath);
+
+    /**
+     * @brief addGeneratedRules Adds all rules of 'numStates' states, which consist of left and right turns ('0'/'1')
+     * and start with a right turn (swapping left and right mirrors the pattern), i.e. 2^(numStates - 1) rules
+     */
+    void addGeneratedRules(int numStates);
+
+    std::size_t getNumRules() const;
+
+    /**
+     * @brief setStepBudget Steps per rule (default 1e8), runs stop earlier if the grid reaches the memory limit
+     */
+    void setStepBudget(uint64_t steps);
+
+    /**
+     * @brief setMemoryLimit Maximum bytes of one grid (default 256 MiB), a run checks the limit between batches of steps
+     */
+    void setMemoryLimit(std::size_t bytes);
+    void setNumThreads(unsigned numThreads);
+
+    /**
+     * @brief setThumbnails Renders a 'size' x 'size' thumbnail of every run (bounding box, nearest neighbour) and passes
+     * it to 'onThumbnail' (called by the writer thread)
+     */
+    void setThumbnails(int size, const std::vector<cf::Color>& palette, const ThumbnailCallback& onThumbnail);
+
+    /**
+     * @brief setThumbnails Writes the thumbnails into 'directory' (file name: name of the run + 'extension')
+     */
+    void setThumbnails(int size, const std::vector<cf::Color>& palette, const std::string& directory,
+                       const std::string& extension = ".png");
+
+    /**
+     * @brief setQueueSize Maximum number of thumbnails waiting for the writer (default 16)
+     */
+    void setQueueSize(std::size_t thumbnails);
+
+    /**
+     * @brief run Simulates all rules
+     * @return Results in the order of the added rules
+     */
+    std::vector<Result> run() const;
+
+    /**
+     * @brief SaveCSV Writes the results as comma separated values (one row per rule)
+     */
+    static void SaveCSV(const std::string& filePath, const std::vector<Result>& results);
+
+  private:
+    /**
+     * @brief _run Simulates the rule 'index', renders the thumbnail (if not nullptr) before the grid is released
+     */
+    Result _run(std::size_t index, cv::Mat* thumbnail) const;
+
+    std::vector<std::pair<std::string, std::string>> m_Rules; /* name, rule */
+    uint64_t m_StepBudget = 100000000;
+    std::size_t m_MemoryLimit = std::size_t(256) << 20;
+    unsigned m_NumThreads = 0;
+    int m_ThumbnailSize = 0; /* 0 -> no thumbnails */
+    std::vector<cf::Color> m_Palette;
+    ThumbnailCallback m_OnThumbnail;
+    std::size_t m_QueueSize = 16;
+};
+} // namespace cf
+
+#endif // TURMITE_SWEEP_H_H
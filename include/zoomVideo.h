@@ -0,0 +1,102 @@
+#ifndef ZOOM_VIDEO_H_H
+#define ZOOM_VIDEO_H_H
+
+#include "colorMap.h"
+
+#include <functional>
+
+namespace cf {
+
+/**
+ * @brief The ZoomVideo struct renders zoom sequences into a fixed center by resampling an exponential map
+ *
+ * the exponential map covers the whole zoom: column a -> angle, row -> logarithmic radius (one octave of radii per strip),
+ * the sample c = center + exp(s + i * angle) is calculated once and colored (use ColorMap::Scaling::CYCLIC, an
+ * equalization per strip results in seams), every frame is synthesized by bilinear interpolation of the strips
+ *
+ * strips are calculated in parallel as soon as a frame requires them and released as soon as the frames left them, the
+ * threads are split among the missing strips (a lone strip is calculated with all threads),
+ * the frames are handed to the consumer (e.g. a video encoder) through a bounded queue, which runs in its own thread
+ */
+struct ZoomVideo {
+    using FrameCallback = std::function<void(int frame, const cv::Mat& image)>;
+
+    /**
+     * @brief The Layout struct Geometry of the exponential map of one render call
+     */
+    struct Layout {
+        int columns = 0;           /* samples per row (angles) */
+        int rowsPerStrip = 0;      /* rows per octave of radii */
+        int numStrips = 0;
+        double startRadius = 0.0;  /* logarithmic radius of the upper edge of row 0 */
+        double rowsPerUnit = 0.0;  /* rows per unit of the logarithmic radius */
+        double halfDiagonal = 0.0; /* distance of the frame corners to the center in pixels */
+
+        /**
+         * @brief row Row of the map (fractional, sample centers at integers) at the distance 'radius' to the center
+         */
+        double row(double radius) const { return (this->startRadius - std::log(radius)) * this->rowsPerUnit - 0.5; }
+
+        /**
+         * @brief strips First and last strip a frame with the pixel size 'pixelSize' requires (from its corners down to a
+         * quarter pixel)
+         */
+        void strips(double pixelSize, int& first, int& last) const;
+    };
+
+    ZoomVideo(const cf::EscapeTime& fractal, const cf::ColorMap& colorMap, const std::complex<double>& center);
+
+    /**
+     * @brief setViewWidths Width of the first and the last frame in the complex plane (default 4 -> 1e-10), the widths of
+     * all other frames follow an exponential curve
+     */
+    void setViewWidths(double startWidth, double endWidth);
+
+    /**
+     * @brief setQueueSize Maximum number of frames waiting for the consumer (default 8)
+     */
+    void setQueueSize(std::size_t frames);
+    void setNumThreads(unsigned numThreads);
+
+    /**
+     * @brief getLayout Exponential map for frames of 'width' x 'height' pixels
+     */
+    Layout getLayout(int width, int height) const;
+
+    /**
+     * @brief getPixelSize Pixel size of the frame 'frame' in the complex plane
+     */
+    double getPixelSize(int width, int frame, int numFrames) const;
+
+    /**
+     * @brief render Renders all frames and passes them in order to 'onFrame' (called by the consumer thread)
+     * @return Number of calculated samples of the exponential map
+     */
+    std::size_t render(int width, int height, int numFrames, const FrameCallback& onFrame) const;
+
+    /**
+     * @brief render Renders all frames into a video file
+     * @param fourcc Codec (e.g. ZoomVideo::FourCC('M', 'J', 'P', 'G'))
+     */
+    std::size_t render(const std::string& filePath, int width, int height, int numFrames, double fps = 30.0,
+                       int fourcc = ZoomVideo::FourCC('M', 'J', 'P', 'G')) const;
+
+    /**
+     * @brief FourCC Codec code of four characters (same as CV_FOURCC/cv::VideoWriter::fourcc of all OpenCV versions)
+     */
+    static constexpr int FourCC(char c1, char c2, char c3, char c4) {
+        return (c1 & 255) | (c2 & 255) << 8 | (c3 & 255) << 16 | (c4 & 255) << 24;
+    }
+
+  private:
+    cf::EscapeTime m_Fractal;
+    cf::ColorMap m_ColorMap;
+    std::complex<double> m_Center;
+    double m_StartWidth = 4.0;
+    double m_EndWidth = 1e-10;
+    std::size_t m_QueueSize = 8;
+    unsigned m_NumThreads = 0;
+};
+} // namespace cf
+
+#endif // ZOOM_VIDEO_H_H
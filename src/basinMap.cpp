@@ -0,0 +1,240 @@
+#include "basinMap.h"
+#include "internal.hpp"
+
+#include <memory>
+#include <unordered_map>
+
+namespace cf {
+
+namespace {
+constexpr const int TILE_SIZE = 32;
+constexpr const std::size_t NUM_ATTRACTOR_SAMPLES = 64;
+constexpr const int32_t UNKNOWN = -1;
+
+// cell of the coarse occupancy grid of the attractor registry
+struct _Cell {
+    int64_t x, y;
+    bool operator==(const _Cell& other) const { return this->x == other.x && this->y == other.y; }
+};
+struct _CellHash {
+    std::size_t operator()(const _Cell& cell) const {
+        uint64_t hash = uint64_t(cell.x) * 0x9E3779B97F4A7C15ull ^ uint64_t(cell.y) * 0xC2B2AE3D27D4EB4Full;
+        return std::size_t(hash ^ (hash >> 29));
+    }
+};
+
+/**
+ * @brief The _AttractorRegistry struct Thread safe list of all found attractors
+ *
+ * the attractors occupy the cells of a coarse grid (cell size >= tolerance), samples match an attractor, if a
+ * neighbouring cell is occupied by it, so a lookup costs 9 hash lookups per sample independent of the number of
+ * attractors, all attractors matched by the same samples are merged (union find, see 'root'), the samples of orbits
+ * without cycle are added to attractors without cycle, so the coverage of chaotic attractors grows with every orbit
+ */
+struct _AttractorRegistry {
+    explicit _AttractorRegistry(double cellSize) : cellSize(cellSize) {}
+
+    /**
+     * @brief find Returns the label of the attractor next to one of the samples, unknown attractors will be added
+     * @param cycle True, if the samples are the points of a detected cycle
+     */
+    int32_t find(const std::vector<glm::dvec2>& samples, bool cycle) {
+        std::vector<_Cell> sampleCells;
+        sampleCells.reserve(samples.size());
+        for (const auto& s : samples)
+            sampleCells.push_back({int64_t(std::floor(s.x / this->cellSize)), int64_t(std::floor(s.y / this->cellSize))});
+
+        std::lock_guard<std::mutex> lg(this->mutex);
+        std::vector<int32_t> touched;
+        for (const _Cell& cell : sampleCells) {
+            for (int64_t dy = -1; dy <= 1; ++dy) {
+                for (int64_t dx = -1; dx <= 1; ++dx) {
+                    const auto it = this->cells.find({cell.x + dx, cell.y + dy});
+                    if (it != this->cells.end())
+                        touched.push_back(this->root(it->second));
+                }
+            }
+        }
+        if (touched.empty()) {
+            this->parents.push_back(int32_t(this->parents.size()) + 1);
+            this->cycles.push_back(cycle);
+            this->attractors.push_back(samples);
+            const int32_t label = int32_t(this->parents.size());
+            for (const _Cell& cell : sampleCells)
+                this->cells.emplace(cell, label);
+            return label;
+        }
+
+        // attractors touched by the same orbit are the same attractor, it is a cycle, if all of them are cycles
+        const int32_t label = *std::min_element(touched.begin(), touched.end());
+        bool allCycles = true;
+        for (const int32_t other : touched) {
+            allCycles = allCycles && this->cycles[other - 1];
+            this->parents[other - 1] = label;
+        }
+        this->cycles[label - 1] = allCycles;
+
+        // orbits without cycle extend attractors without cycle (the transients of cycles are not added)
+        if (!cycle && !allCycles) {
+            for (const _Cell& cell : sampleCells)
+                this->cells.emplace(cell, label);
+        }
+        return label;
+    }
+
+    /**
+     * @brief root Label of the attractor 'label' has been merged into (the smallest label of the merged attractors)
+     */
+    int32_t root(int32_t label) const {
+        while (this->parents[label - 1] != label)
+            label = this->parents[label - 1];
+        return label;
+    }
+
+    double cellSize;
+    std::mutex mutex;
+    std::unordered_map<_Cell, int32_t, _CellHash> cells;
+    std::vector<int32_t> parents; /* label - 1 -> label of the attractor it has been merged into (itself -> root) */
+    std::vector<bool> cycles;     /* label - 1 -> attractor is a detected cycle */
+    std::vector<std::vector<glm::dvec2>> attractors;
+};
+} // namespace
+
+BasinMap::BasinMap(const OrbitMap& map) : m_Map(map) {}
+BasinMap::BasinMap(const Orbit& orbit) : m_Map(orbit) {}
+
+void BasinMap::setIterations(std::size_t maxIterations) { this->m_MaxIterations = maxIterations; }
+void BasinMap::setEscapeRadius(double radius) { this->m_EscapeRadius = radius; }
+void BasinMap::setAttractorTolerance(double tolerance) { this->m_AttractorTolerance = tolerance; }
+void BasinMap::setLabelReuse(bool reuse) { this->m_LabelReuse = reuse; }
+void BasinMap::setNumThreads(unsigned numThreads) { this->m_NumThreads = numThreads; }
+
+BasinMap::Result BasinMap::calculate(int width, int height, const Interval& range_x, const Interval& range_y) const {
+    if (width <= 0 || height <= 0)
+        throw std::runtime_error(R"(Error: invalid image size in function "BasinMap::calculate")");
+
+    const std::size_t numPixels = std::size_t(width) * std::size_t(height);
+    std::unique_ptr<std::atomic<int32_t>[]> labels(new std::atomic<int32_t>[numPixels]);
+    for (std::size_t i = 0; i < numPixels; ++i)
+        labels[i].store(UNKNOWN, std::memory_order_relaxed);
+
+    const double stepX = (double(range_x.max) - double(range_x.min)) / width;
+    const double stepY = (double(range_y.max) - double(range_y.min)) / height;
+    // attractors are compared on a grid of (at least) one pixel
+    const double sampleTolerance = std::max(this->m_AttractorTolerance, std::max(stepX, stepY));
+
+    OrbitEngine engine(this->m_Map);
+    engine.setCycleDetection(OrbitEngine::CycleHandling::STOP, this->m_AttractorTolerance);
+    _AttractorRegistry registry(sampleTolerance);
+
+    const int tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+    const int tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+    const unsigned numThreads = internal::_NumThreads(this->m_NumThreads, std::size_t(tilesX) * tilesY);
+    std::vector<std::size_t> evaluations(numThreads, 0);
+    std::vector<std::size_t> reusedLabels(numThreads, 0);
+
+    internal::_ParallelFor(std::size_t(tilesX) * tilesY, numThreads, [&](unsigned threadIdx, std::size_t tile) {
+        const int tileX = int(tile % tilesX) * TILE_SIZE;
+        const int tileY = int(tile / tilesX) * TILE_SIZE;
+        std::vector<glm::dvec2> samples(NUM_ATTRACTOR_SAMPLES);
+
+        for (int row = tileY; row < std::min(height, tileY + TILE_SIZE); ++row) {
+            for (int col = tileX; col < std::min(width, tileX + TILE_SIZE); ++col) {
+                const glm::dvec2 start(range_x.min + (col + 0.5) * stepX, range_y.max - (row + 0.5) * stepY);
+                int32_t label = UNKNOWN;
+                bool reused = false;
+
+                const auto result = engine.iterate(start, this->m_MaxIterations, [&](const glm::dvec2& p, std::size_t iter) {
+                    if (!(std::abs(p.x) <= this->m_EscapeRadius && std::abs(p.y) <= this->m_EscapeRadius)) {
+                        label = DIVERGED;
+                        return false;
+                    }
+                    samples[iter % NUM_ATTRACTOR_SAMPLES] = p;
+                    if (!this->m_LabelReuse)
+                        return true;
+
+                    // follow until known
+                    const double c = (p.x - range_x.min) / stepX;
+                    const double r = (range_y.max - p.y) / stepY;
+                    if (c >= 0.0 && r >= 0.0 && c < width && r < height) {
+                        const int32_t known = labels[std::size_t(r) * width + std::size_t(c)].load(std::memory_order_relaxed);
+                        if (known != UNKNOWN) {
+                            label = known;
+                            reused = true;
+                            return false;
+                        }
+                    }
+                    return true;
+                });
+                evaluations[threadIdx] += result.evaluations;
+
+                if (reused)
+                    ++reusedLabels[threadIdx];
+                else if (result.diverged)
+                    label = DIVERGED;
+                else if (label == UNKNOWN) {
+                    std::vector<glm::dvec2> attractor;
+                    if (result.period) {
+                        // the last point lies on the cycle
+                        glm::dvec2 p = samples[result.iterations % NUM_ATTRACTOR_SAMPLES];
+                        for (std::size_t i = 0; i < std::min(result.period, NUM_ATTRACTOR_SAMPLES); ++i) {
+                            attractor.push_back(p);
+                            p = this->m_Map(p);
+                        }
+                        label = registry.find(attractor, true);
+                    } else {
+                        const std::size_t numSamples = std::min(result.iterations, NUM_ATTRACTOR_SAMPLES);
+                        attractor.assign(samples.begin(), samples.begin() + numSamples);
+                        label = registry.find(attractor, false);
+                    }
+                }
+                labels[std::size_t(row) * width + col].store(label, std::memory_order_relaxed);
+            }
+        }
+    });
+
+    Result result;
+    result.width = width;
+    result.height = height;
+    // merged attractors: consecutive labels of the roots, the samples of merged attractors are joined
+    std::vector<int32_t> finalLabels(registry.parents.size() + 1, DIVERGED);
+    for (std::size_t idx = 0; idx < registry.parents.size(); ++idx) {
+        const int32_t root = registry.root(int32_t(idx) + 1);
+        if (root == int32_t(idx) + 1) {
+            result.attractors.push_back(std::move(registry.attractors[idx]));
+            finalLabels[idx + 1] = int32_t(result.attractors.size());
+        } else {
+            finalLabels[idx + 1] = finalLabels[root];
+            std::vector<glm::dvec2>& attractor = result.attractors[finalLabels[root] - 1];
+            attractor.insert(attractor.end(), registry.attractors[idx].begin(), registry.attractors[idx].end());
+        }
+    }
+    result.labels.resize(numPixels);
+    for (std::size_t i = 0; i < numPixels; ++i)
+        result.labels[i] = finalLabels[labels[i].load(std::memory_order_relaxed)];
+    for (unsigned t = 0; t < numThreads; ++t) {
+        result.evaluations += evaluations[t];
+        result.reusedLabels += reusedLabels[t];
+    }
+    return result;
+}
+
+void BasinMap::render(WindowVectorized& window, const std::vector<Color>& palette) const {
+    if (palette.size() < 2)
+        throw std::runtime_error(R"(Error: palette requires at least two colors in function "BasinMap::render")");
+
+    cv::Mat& image = window.getImage();
+    const Result result = this->calculate(image.cols, image.rows, window.getIntervalX(), window.getIntervalY());
+    for (int row = 0; row < image.rows; ++row) {
+        const int32_t* labels = &result.labels[std::size_t(row) * image.cols];
+        cv::Vec3b* pixel = image.ptr<cv::Vec3b>(row);
+        for (int col = 0; col < image.cols; ++col) {
+            const int32_t l = labels[col];
+            const Color& c = l <= DIVERGED ? palette.front() : palette[1 + std::size_t(l - 1) % (palette.size() - 1)];
+            pixel[col][0] = c.b;
+            pixel[col][1] = c.g;
+            pixel[col][2] = c.r;
+        }
+    }
+}
+} // namespace cf
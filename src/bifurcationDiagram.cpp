@@ -0,0 +1,93 @@
+#include "bifurcationDiagram.h"
+#include "internal.hpp"
+
+namespace cf {
+
+BifurcationDiagram::BifurcationDiagram(const Orbit& orbit, std::size_t factorIndex)
+    : BifurcationDiagram(OrbitMap(orbit),
+                         orbit.getNumStartingPoints()
+                             ? glm::dvec2(orbit.getAllStartingPoints().front().x, orbit.getAllStartingPoints().front().y)
+                             : glm::dvec2(0.0),
+                         factorIndex) {}
+
+BifurcationDiagram::BifurcationDiagram(const OrbitMap& map, const glm::dvec2& startingPoint, std::size_t factorIndex)
+    : m_Map(map), m_StartingPoint(startingPoint), m_FactorIndex(factorIndex) {
+    if (factorIndex >= OrbitMap::NUM_FACTORS)
+        throw std::out_of_range(R"(out of bound exception, in function "BifurcationDiagram::BifurcationDiagram")");
+}
+
+void BifurcationDiagram::setIterations(std::size_t transient, std::size_t plotted) {
+    this->m_TransientIterations = transient;
+    this->m_PlottedIterations = plotted;
+}
+void BifurcationDiagram::setPlottedCoordinate(Coordinate coordinate) { this->m_Coordinate = coordinate; }
+void BifurcationDiagram::setCycleTolerance(double tolerance) { this->m_CycleTolerance = tolerance; }
+void BifurcationDiagram::setNumThreads(unsigned numThreads) { this->m_NumThreads = numThreads; }
+
+void BifurcationDiagram::calculate(DensityCanvas& canvas) const {
+    canvas.clear();
+    const unsigned numThreads = internal::_NumThreads(this->m_NumThreads, std::size_t(canvas.getWidth()));
+
+    // every thread accumulates one column into its own histogram,
+    // afterwards the histogram is copied into the (row major) canvas
+    std::vector<std::vector<uint32_t>> histograms(numThreads, std::vector<uint32_t>(std::size_t(canvas.getHeight())));
+    internal::_ParallelFor(std::size_t(canvas.getWidth()), numThreads, [&](unsigned threadIdx, std::size_t col) {
+        auto& histogram = histograms[threadIdx];
+        std::fill(histogram.begin(), histogram.end(), 0);
+        this->_calculateColumn(canvas, int(col), histogram);
+        for (int row = 0; row < canvas.getHeight(); ++row)
+            canvas.getRow(row)[col] = histogram[std::size_t(row)];
+    });
+}
+
+void BifurcationDiagram::render(WindowVectorized& window, const std::vector<Color>& palette) const {
+    DensityCanvas canvas(window);
+    this->calculate(canvas);
+    canvas.render(window, palette, DensityCanvas::Normalization::PER_COLUMN);
+}
+
+void BifurcationDiagram::_calculateColumn(const DensityCanvas& canvas, int col, std::vector<uint32_t>& histogram) const {
+    const Interval& rangeX = canvas.getRangeX();
+    const Interval& rangeY = canvas.getRangeY();
+    const double factor = rangeX.min + (col + 0.5) * (double(rangeX.max) - double(rangeX.min)) / canvas.getWidth();
+    const double scaleY = canvas.getHeight() / (double(rangeY.max) - double(rangeY.min));
+    const int height = canvas.getHeight();
+    const bool plotX = this->m_Coordinate == Coordinate::X;
+
+    OrbitEngine engine(this->m_Map);
+    engine.getMap().factors[this->m_FactorIndex] = factor;
+    if (this->m_CycleTolerance > 0.0)
+        engine.setCycleDetection(OrbitEngine::CycleHandling::STOP, this->m_CycleTolerance);
+
+    auto addPoint = [&](const glm::dvec2& p, uint32_t weight) {
+        const double row = (rangeY.max - (plotX ? p.x : p.y)) * scaleY;
+        if (row >= 0.0 && row < height)
+            histogram[std::size_t(row)] += weight;
+    };
+
+    const std::size_t transient = this->m_TransientIterations;
+    const std::size_t numIterations = transient + this->m_PlottedIterations;
+    glm::dvec2 lastPoint;
+    const auto result = engine.iterate(this->m_StartingPoint, numIterations, [&](const glm::dvec2& p, std::size_t iter) {
+        lastPoint = p;
+        if (iter > transient)
+            addPoint(p, 1);
+    });
+    if (!result.period || result.diverged)
+        return;
+
+    // the orbit collapsed onto a cycle, weight every cycle point with its remaining number of visits
+    const std::size_t plotted = result.iterations > transient ? result.iterations - transient : 0;
+    const std::size_t remaining = this->m_PlottedIterations - plotted;
+    const uint32_t weight = uint32_t(remaining / result.period);
+    if (!weight)
+        return;
+
+    // the last point lies on the cycle
+    glm::dvec2 p = lastPoint;
+    for (std::size_t i = 0; i < result.period; ++i) {
+        addPoint(p, weight);
+        p = engine.getMap()(p);
+    }
+}
+} // namespace cf
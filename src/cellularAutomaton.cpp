@@ -0,0 +1,253 @@
+#include "cellularAutomaton.h"
+#include "internal.hpp"
+
+#include <cctype>
+#include <random>
+
+namespace cf {
+
+namespace {
+constexpr const int ROWS_PER_TASK = 64;
+
+/**
+ * @brief _TrySet Selects the kernel of '_Rule', if it equals 'rule'
+ */
+template <typename _Rule> bool _TrySet(CellularAutomaton& automaton, const CellularAutomaton::Rule& rule) {
+    if (rule != CellularAutomaton::Rule{_Rule::birth, _Rule::survival, _Rule::states})
+        return false;
+    automaton.setRule<_Rule>();
+    return true;
+}
+} // namespace
+
+CellularAutomaton::Rule CellularAutomaton::Rule::Parse(const std::string& rule) {
+    std::string text;
+    for (char c : rule)
+        if (!std::isspace(static_cast<unsigned char>(c)))
+            text += char(std::toupper(static_cast<unsigned char>(c)));
+    if (text.empty())
+        throw std::runtime_error(R"(Error: empty rule in function "CellularAutomaton::Rule::Parse")");
+
+    // fields by letter (B/S/C) or by position (S/B/C)
+    std::string fields[3];
+    bool present[3] = {false, false, false};
+    if (text.find_first_of("BSCG") != std::string::npos) {
+        int field = -1;
+        for (char c : text) {
+            if (c == 'B' || c == 'S' || c == 'C' || c == 'G') {
+                field = c == 'B' ? 0 : c == 'S' ? 1 : 2;
+                if (present[field])
+                    throw std::runtime_error(R"(Error: field defined twice in function "CellularAutomaton::Rule::Parse")");
+                present[field] = true;
+            } else if (std::isdigit(static_cast<unsigned char>(c)) && field >= 0) {
+                fields[field] += c;
+            } else if (c != '/') {
+                throw std::runtime_error(R"(Error: invalid character in function "CellularAutomaton::Rule::Parse")");
+            }
+        }
+        if (!present[0] || !present[1])
+            throw std::runtime_error(R"(Error: birth or survival missing in function "CellularAutomaton::Rule::Parse")");
+    } else {
+        const int order[3] = {1, 0, 2}; // survival/birth/states
+        int field = 0;
+        for (char c : text) {
+            if (c == '/') {
+                if (++field > 2)
+                    throw std::runtime_error(R"(Error: too many fields in function "CellularAutomaton::Rule::Parse")");
+            } else if (std::isdigit(static_cast<unsigned char>(c))) {
+                fields[order[field]] += c;
+            } else {
+                throw std::runtime_error(R"(Error: invalid character in function "CellularAutomaton::Rule::Parse")");
+            }
+        }
+        if (field == 0)
+            throw std::runtime_error(R"(Error: birth or survival missing in function "CellularAutomaton::Rule::Parse")");
+        present[2] = field == 2;
+    }
+
+    Rule result;
+    uint16_t* sets[2] = {&result.birth, &result.survival};
+    for (int i = 0; i < 2; ++i) {
+        *sets[i] = 0;
+        for (char c : fields[i]) {
+            if (c == '9')
+                throw std::runtime_error(R"(Error: count not within [0, 8] in function "CellularAutomaton::Rule::Parse")");
+            *sets[i] |= uint16_t(1 << (c - '0'));
+        }
+    }
+    if (present[2]) {
+        if (fields[2].empty() || fields[2].size() > 3 || std::stoi(fields[2]) < 2 || std::stoi(fields[2]) > 256)
+            throw std::runtime_error(R"(Error: states not within [2, 256] in function "CellularAutomaton::Rule::Parse")");
+        result.states = std::stoi(fields[2]);
+    }
+    return result;
+}
+
+std::string CellularAutomaton::Rule::toString() const {
+    std::string text = "B";
+    for (int count = 0; count <= 8; ++count)
+        if ((this->birth >> count) & 1)
+            text += char('0' + count);
+    text += "/S";
+    for (int count = 0; count <= 8; ++count)
+        if ((this->survival >> count) & 1)
+            text += char('0' + count);
+    if (this->states > 2)
+        text += "/C" + std::to_string(this->states);
+    return text;
+}
+
+CellularAutomaton::CellularAutomaton(int width, int height, const std::string& rule, Topology topology)
+    : m_Width(width), m_Height(height), m_Topology(topology) {
+    if (width <= 0 || height <= 0)
+        throw std::runtime_error(R"(Error: invalid grid size in function "CellularAutomaton::CellularAutomaton")");
+    this->m_Cells.assign(std::size_t(width) * height, 0);
+    this->m_Next.assign(this->m_Cells.size(), 0);
+    this->setRule(rule);
+}
+
+CellularAutomaton CellularAutomaton::FromDATFile(const std::string& filePath, int width, int height,
+                                                 const std::string& rule, Topology topology) {
+    const std::vector<glm::vec3> points = readDATFile(filePath);
+    CellularAutomaton automaton(width, height, rule, topology);
+    if (points.empty())
+        return automaton;
+
+    glm::vec3 minimum = points.front(), maximum = points.front();
+    for (const glm::vec3& point : points) {
+        minimum = glm::min(minimum, point);
+        maximum = glm::max(maximum, point);
+    }
+    automaton.load(points, (width - int(maximum.x - minimum.x) - 1) / 2 - int(minimum.x),
+                   (height - int(maximum.y - minimum.y) - 1) / 2 - int(minimum.y));
+    return automaton;
+}
+
+void CellularAutomaton::setRule(const std::string& rule) { this->setRule(Rule::Parse(rule)); }
+
+void CellularAutomaton::setRule(const Rule& rule) {
+    if (rule.birth >= 512 || rule.survival >= 512 || rule.states < 2 || rule.states > 256)
+        throw std::runtime_error(R"(Error: invalid rule in function "CellularAutomaton::setRule")");
+
+    // pre-instantiated kernels of common rules
+    if (_TrySet<ca::Conway>(*this, rule) || _TrySet<ca::HighLife>(*this, rule) || _TrySet<ca::DayAndNight>(*this, rule) ||
+        _TrySet<ca::Seeds>(*this, rule) || _TrySet<ca::BriansBrain>(*this, rule) || _TrySet<ca::StarWars>(*this, rule))
+        return;
+    this->_setRule(rule, &CellularAutomaton::_Row<Rule>, false);
+}
+
+void CellularAutomaton::_setRule(const Rule& rule, _RowFunction row, bool compiled) {
+    this->m_Rule = rule;
+    this->m_Row = row;
+    this->m_Compiled = compiled;
+    for (uint8_t& cell : this->m_Cells)
+        if (cell >= rule.states)
+            cell = 0;
+}
+
+const CellularAutomaton::Rule& CellularAutomaton::getRule() const { return this->m_Rule; }
+bool CellularAutomaton::hasCompiledKernel() const { return this->m_Compiled; }
+
+void CellularAutomaton::load(const std::vector<glm::vec3>& points, int offsetX, int offsetY) {
+    for (const glm::vec3& point : points) {
+        const int x = int(point.x) + offsetX, y = int(point.y) + offsetY;
+        if (x < 0 || y < 0 || x >= this->m_Width || y >= this->m_Height)
+            throw std::runtime_error(R"(Error: cell outside of the grid in function "CellularAutomaton::load")");
+        this->set(x, y, uint8_t(std::min(std::max(int(point.z), 0), this->m_Rule.states - 1)));
+    }
+}
+
+void CellularAutomaton::randomize(double density, uint32_t seed) {
+    std::mt19937 generator(seed);
+    std::bernoulli_distribution alive(std::min(std::max(density, 0.0), 1.0));
+    for (uint8_t& cell : this->m_Cells)
+        cell = uint8_t(alive(generator));
+}
+
+uint8_t CellularAutomaton::get(int x, int y) const {
+    if (x < 0 || y < 0 || x >= this->m_Width || y >= this->m_Height)
+        return 0;
+    return this->m_Cells[std::size_t(y) * this->m_Width + x];
+}
+
+void CellularAutomaton::set(int x, int y, uint8_t state) {
+    if (x < 0 || y < 0 || x >= this->m_Width || y >= this->m_Height)
+        throw std::runtime_error(R"(Error: cell outside of the grid in function "CellularAutomaton::set")");
+    if (state >= this->m_Rule.states)
+        throw std::runtime_error(R"(Error: state not within the rule in function "CellularAutomaton::set")");
+    this->m_Cells[std::size_t(y) * this->m_Width + x] = state;
+}
+
+void CellularAutomaton::clear() {
+    std::fill(this->m_Cells.begin(), this->m_Cells.end(), 0);
+    this->m_Generation = 0;
+}
+
+void CellularAutomaton::step(uint64_t generations) {
+    const int width = this->m_Width;
+    const int height = this->m_Height;
+    const bool torus = this->m_Topology == Topology::TORUS;
+    const std::size_t tasks = std::size_t((height + ROWS_PER_TASK - 1) / ROWS_PER_TASK);
+    const unsigned numThreads = internal::_NumThreads(this->m_NumThreads, tasks);
+    std::vector<std::vector<uint8_t>> sums(numThreads, std::vector<uint8_t>(std::size_t(width) + 2));
+    const std::vector<uint8_t> deadRow(std::size_t(width), 0);
+
+    for (uint64_t generation = 0; generation < generations; ++generation) {
+        const uint8_t* cells = this->m_Cells.data();
+        uint8_t* next = this->m_Next.data();
+        internal::_ParallelFor(tasks, numThreads, [&](unsigned thread, std::size_t task) {
+            auto row = [&](int y) {
+                if (!torus && (y < 0 || y >= height))
+                    return deadRow.data();
+                return cells + std::size_t((y + height) % height) * width;
+            };
+            const int lastRow = std::min(height, int(task + 1) * ROWS_PER_TASK);
+            for (int y = int(task) * ROWS_PER_TASK; y < lastRow; ++y)
+                this->m_Row(this->m_Rule, row(y - 1), row(y), row(y + 1), next + std::size_t(y) * width,
+                            sums[thread].data(), width, torus);
+        });
+        this->m_Cells.swap(this->m_Next);
+        ++this->m_Generation;
+    }
+}
+
+void CellularAutomaton::setNumThreads(unsigned numThreads) { this->m_NumThreads = numThreads; }
+uint64_t CellularAutomaton::getGeneration() const { return this->m_Generation; }
+
+uint64_t CellularAutomaton::getPopulation() const {
+    return uint64_t(this->m_Cells.size()) - uint64_t(std::count(this->m_Cells.begin(), this->m_Cells.end(), uint8_t(0)));
+}
+
+int CellularAutomaton::getWidth() const { return this->m_Width; }
+int CellularAutomaton::getHeight() const { return this->m_Height; }
+CellularAutomaton::Topology CellularAutomaton::getTopology() const { return this->m_Topology; }
+const std::vector<uint8_t>& CellularAutomaton::getCells() const { return this->m_Cells; }
+
+void CellularAutomaton::render(cv::Mat& image, const Color& alive, const Color& dead) const {
+    // colors of all states: dead, alive and the dying states fading to dead
+    std::vector<Color> colors(std::size_t(this->m_Rule.states), dead);
+    for (int state = 1; state < this->m_Rule.states; ++state) {
+        const double t = double(state - 1) / double(this->m_Rule.states - 1);
+        colors[state] = Color(uint8_t(alive.r + (dead.r - alive.r) * t + 0.5), uint8_t(alive.g + (dead.g - alive.g) * t + 0.5),
+                              uint8_t(alive.b + (dead.b - alive.b) * t + 0.5));
+    }
+
+    std::vector<int> cellX(image.cols);
+    for (int col = 0; col < image.cols; ++col)
+        cellX[col] = int(double(col) * this->m_Width / image.cols);
+    for (int row = 0; row < image.rows; ++row) {
+        const uint8_t* cells = &this->m_Cells[std::size_t(double(row) * this->m_Height / image.rows) * this->m_Width];
+        cv::Vec3b* pixel = image.ptr<cv::Vec3b>(row);
+        for (int col = 0; col < image.cols; ++col) {
+            const Color& c = colors[cells[cellX[col]]];
+            pixel[col][0] = c.b;
+            pixel[col][1] = c.g;
+            pixel[col][2] = c.r;
+        }
+    }
+}
+
+void CellularAutomaton::render(WindowRasterized& window, const Color& alive, const Color& dead) const {
+    this->render(window.getImage(), alive, dead);
+}
+} // namespace cf
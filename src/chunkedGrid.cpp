@@ -0,0 +1,171 @@
+#include "chunkedGrid.h"
+
+#include <cstring>
+
+namespace cf {
+
+namespace {
+constexpr const std::size_t MIN_DIRECTORY_SIZE = 64; // power of two
+
+void _Render(cv::Mat& image, const ChunkedGrid& grid, const std::vector<Color>& palette, int64_t minX, int64_t minY,
+             int64_t columns, int64_t rows) {
+    if (palette.empty())
+        throw std::runtime_error(R"(Error: empty palette in function "ChunkedGrid::render")");
+    if (columns <= 0 || rows <= 0)
+        throw std::runtime_error(R"(Error: empty region in function "ChunkedGrid::render")");
+
+    // cells of one image row share the chunk row, the chunk lookup is only repeated at chunk borders
+    std::vector<int64_t> cellX(image.cols);
+    for (int col = 0; col < image.cols; ++col)
+        cellX[col] = minX + int64_t(double(col) * columns / image.cols);
+    for (int row = 0; row < image.rows; ++row) {
+        const int64_t y = minY + int64_t(double(row) * rows / image.rows);
+        const int64_t chunkY = ChunkedGrid::ChunkCoordinate(y);
+        const int localY = ChunkedGrid::LocalCoordinate(y);
+        const ChunkedGrid::Chunk* chunk = nullptr;
+        int64_t chunkX = 0;
+        cv::Vec3b* pixel = image.ptr<cv::Vec3b>(row);
+        for (int col = 0; col < image.cols; ++col) {
+            if (!col || ChunkedGrid::ChunkCoordinate(cellX[col]) != chunkX) {
+                chunkX = ChunkedGrid::ChunkCoordinate(cellX[col]);
+                chunk = grid.findChunk(chunkX, chunkY);
+            }
+            const uint8_t state =
+                chunk ? chunk->cells[localY * ChunkedGrid::CHUNK_SIZE + ChunkedGrid::LocalCoordinate(cellX[col])] : 0;
+            const Color& c = palette[state % palette.size()];
+            pixel[col][0] = c.b;
+            pixel[col][1] = c.g;
+            pixel[col][2] = c.r;
+        }
+    }
+}
+} // namespace
+
+ChunkedGrid::ChunkedGrid() : m_Directory(MIN_DIRECTORY_SIZE, nullptr) {}
+
+ChunkedGrid::ChunkedGrid(const ChunkedGrid& other) : ChunkedGrid() {
+    for (const Chunk* chunk : other.m_Chunks)
+        std::memcpy(this->getChunk(chunk->x, chunk->y).cells, chunk->cells, sizeof(chunk->cells));
+}
+
+ChunkedGrid::ChunkedGrid(ChunkedGrid&& other)
+    : m_Pool(std::move(other.m_Pool)), m_Chunks(std::move(other.m_Chunks)), m_Directory(std::move(other.m_Directory)),
+      m_Hot(other.m_Hot) {
+    other.m_Chunks.clear();
+    other.m_Directory.assign(MIN_DIRECTORY_SIZE, nullptr);
+    other.m_Hot = nullptr;
+}
+
+ChunkedGrid& ChunkedGrid::operator=(ChunkedGrid other) {
+    std::swap(this->m_Pool, other.m_Pool);
+    std::swap(this->m_Chunks, other.m_Chunks);
+    std::swap(this->m_Directory, other.m_Directory);
+    std::swap(this->m_Hot, other.m_Hot);
+    return *this;
+}
+
+std::size_t ChunkedGrid::_slot(int64_t chunkX, int64_t chunkY) const {
+    uint64_t hash = uint64_t(chunkX) * 0x9E3779B97F4A7C15ull ^ uint64_t(chunkY) * 0xC2B2AE3D27D4EB4Full;
+    hash ^= hash >> 29;
+    return std::size_t(hash) & (this->m_Directory.size() - 1);
+}
+
+const ChunkedGrid::Chunk* ChunkedGrid::findChunk(int64_t chunkX, int64_t chunkY) const {
+    const std::size_t mask = this->m_Directory.size() - 1;
+    for (std::size_t slot = this->_slot(chunkX, chunkY);; slot = (slot + 1) & mask) {
+        const Chunk* chunk = this->m_Directory[slot];
+        if (!chunk || (chunk->x == chunkX && chunk->y == chunkY))
+            return chunk;
+    }
+}
+
+ChunkedGrid::Chunk& ChunkedGrid::_findOrAllocate(int64_t chunkX, int64_t chunkY) {
+    const std::size_t mask = this->m_Directory.size() - 1;
+    std::size_t slot = this->_slot(chunkX, chunkY);
+    for (; this->m_Directory[slot]; slot = (slot + 1) & mask) {
+        if (this->m_Directory[slot]->x == chunkX && this->m_Directory[slot]->y == chunkY)
+            return *this->m_Directory[slot];
+    }
+
+    // next chunk of the pool (load factor of the directory <= 0.5)
+    const std::size_t idx = this->m_Chunks.size();
+    if (idx == this->m_Pool.size() * POOL_BLOCK)
+        this->m_Pool.emplace_back(new Chunk[POOL_BLOCK]);
+    Chunk* chunk = &this->m_Pool[idx / POOL_BLOCK][idx % POOL_BLOCK];
+    chunk->x = chunkX;
+    chunk->y = chunkY;
+    std::memset(chunk->cells, 0, sizeof(chunk->cells));
+    this->m_Chunks.push_back(chunk);
+    this->m_Directory[slot] = chunk;
+    if (2 * this->m_Chunks.size() > this->m_Directory.size())
+        this->_grow();
+    return *chunk;
+}
+
+void ChunkedGrid::_grow() {
+    this->m_Directory.assign(2 * this->m_Directory.size(), nullptr);
+    const std::size_t mask = this->m_Directory.size() - 1;
+    for (Chunk* chunk : this->m_Chunks) {
+        std::size_t slot = this->_slot(chunk->x, chunk->y);
+        while (this->m_Directory[slot])
+            slot = (slot + 1) & mask;
+        this->m_Directory[slot] = chunk;
+    }
+}
+
+const std::vector<ChunkedGrid::Chunk*>& ChunkedGrid::getChunks() const { return this->m_Chunks; }
+
+bool ChunkedGrid::getBounds(int64_t& minX, int64_t& minY, int64_t& maxX, int64_t& maxY) const {
+    bool found = false;
+    for (const Chunk* chunk : this->m_Chunks) {
+        // chunks completely within the current bounds cannot extend them
+        const int64_t chunkMinX = chunk->x * CHUNK_SIZE, chunkMinY = chunk->y * CHUNK_SIZE;
+        if (found && chunkMinX >= minX && chunkMinY >= minY && chunkMinX + CHUNK_SIZE - 1 <= maxX &&
+            chunkMinY + CHUNK_SIZE - 1 <= maxY)
+            continue;
+        for (int y = 0; y < CHUNK_SIZE; ++y) {
+            for (int x = 0; x < CHUNK_SIZE; ++x) {
+                if (!chunk->cells[y * CHUNK_SIZE + x])
+                    continue;
+                if (!found) {
+                    minX = maxX = chunkMinX + x;
+                    minY = maxY = chunkMinY + y;
+                    found = true;
+                }
+                minX = std::min(minX, chunkMinX + x);
+                maxX = std::max(maxX, chunkMinX + x);
+                minY = std::min(minY, chunkMinY + y);
+                maxY = std::max(maxY, chunkMinY + y);
+            }
+        }
+    }
+    return found;
+}
+
+std::size_t ChunkedGrid::getNumChunks() const { return this->m_Chunks.size(); }
+
+std::size_t ChunkedGrid::getMemoryUsage() const {
+    return this->m_Pool.size() * POOL_BLOCK * sizeof(Chunk) + this->m_Directory.size() * sizeof(Chunk*);
+}
+
+void ChunkedGrid::clear() {
+    this->m_Chunks.clear();
+    this->m_Directory.assign(MIN_DIRECTORY_SIZE, nullptr);
+    this->m_Hot = nullptr;
+}
+
+void ChunkedGrid::render(cv::Mat& image, const std::vector<Color>& palette, int64_t minX, int64_t minY, int64_t columns,
+                         int64_t rows) const {
+    _Render(image, *this, palette, minX, minY, columns, rows);
+}
+
+void ChunkedGrid::render(Window2D& window, const std::vector<Color>& palette, int64_t minX, int64_t minY,
+                         int64_t columns, int64_t rows) const {
+    _Render(window.getImage(), *this, palette, minX, minY, columns, rows);
+}
+
+void ChunkedGrid::render(WindowRasterized& window, const std::vector<Color>& palette, int64_t minX, int64_t minY,
+                         int64_t columns, int64_t rows) const {
+    _Render(window.getImage(), *this, palette, minX, minY, columns, rows);
+}
+} // namespace cf
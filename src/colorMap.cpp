@@ -0,0 +1,163 @@
+#include "colorMap.h"
+#include "internal.hpp"
+
+#include <cmath>
+
+namespace cf {
+
+namespace {
+constexpr const int ROWS_PER_TASK = 16;
+
+int _NumTasks(const EscapeTime::Result& result) { return (result.height + ROWS_PER_TASK - 1) / ROWS_PER_TASK; }
+} // namespace
+
+ColorMap::ColorMap(const std::vector<Color>& palette, const Color& insideColor)
+    : m_InsideColor(insideColor), m_Period(float(palette.size())) {
+    if (palette.empty())
+        throw std::runtime_error(R"(Error: empty palette in function "ColorMap::ColorMap")");
+    for (const auto& c : palette) {
+        this->m_Red.push_back(c.r);
+        this->m_Green.push_back(c.g);
+        this->m_Blue.push_back(c.b);
+    }
+}
+
+ColorMap ColorMap::FromFile(const std::string& filePath, const Color& insideColor) {
+    return ColorMap(readPaletteFromFile(filePath), insideColor);
+}
+
+void ColorMap::setScaling(Scaling scaling) { this->m_Scaling = scaling; }
+void ColorMap::setPeriod(float iterations) {
+    if (!(iterations > 0.f))
+        throw std::runtime_error(R"(Error: period has to be positive in function "ColorMap::setPeriod")");
+    this->m_Period = iterations;
+}
+void ColorMap::setNumThreads(unsigned numThreads) { this->m_NumThreads = numThreads; }
+
+std::vector<float> ColorMap::SmoothIterations(const EscapeTime::Result& result, unsigned numThreads) {
+    std::vector<float> smooth(result.iterations.size());
+    const int width = result.width;
+
+    // nu = n - log2(ln|z_n| / ln(radius)) is within [n - 1, n) (|z_n| ~ radius^2 at most), radii <= 1 -> nu = n
+    const double logRadius2Inverse = result.escapeRadius > 1.0 ? 0.5 / std::log(result.escapeRadius) : 0.0;
+    internal::_ParallelFor(std::size_t(_NumTasks(result)), numThreads, [&](unsigned, std::size_t task) {
+        const std::size_t begin = task * ROWS_PER_TASK * width;
+        const std::size_t end = std::min(result.iterations.size(), (task + 1) * ROWS_PER_TASK * width);
+        for (std::size_t idx = begin; idx < end; ++idx) {
+            const double ratio = std::max(1.0, std::log(result.norms[idx]) * logRadius2Inverse);
+            smooth[idx] = result.isInside(idx) ? -1.f : std::max(0.f, float(result.iterations[idx] - std::log2(ratio)));
+        }
+    });
+    return smooth;
+}
+
+std::vector<float> ColorMap::calculatePositions(const EscapeTime::Result& result) const {
+    std::vector<float> positions = ColorMap::SmoothIterations(result, this->m_NumThreads);
+    const float paletteSize = float(this->m_Red.size());
+    const int width = result.width;
+    const std::size_t numTasks = std::size_t(_NumTasks(result));
+    const unsigned numThreads = internal::_NumThreads(this->m_NumThreads, numTasks);
+    auto taskRange = [&](std::size_t task) {
+        return std::make_pair(task * ROWS_PER_TASK * width, std::min(positions.size(), (task + 1) * ROWS_PER_TASK * width));
+    };
+
+    if (this->m_Scaling == Scaling::CYCLIC) {
+        const float scale = paletteSize / this->m_Period;
+        internal::_ParallelFor(numTasks, numThreads, [&](unsigned, std::size_t task) {
+            const auto range = taskRange(task);
+            for (std::size_t idx = range.first; idx < range.second; ++idx) {
+                if (positions[idx] >= 0.f) {
+                    const float p = positions[idx] * scale;
+                    const float wrapped = p - std::floor(p / paletteSize) * paletteSize;
+                    positions[idx] = wrapped < paletteSize ? wrapped : 0.f; // rounding may result in 'paletteSize'
+                }
+            }
+        });
+        return positions;
+    }
+
+    // histogram of the integral parts (one per thread), nu < maxIterations
+    const std::size_t numBins = std::size_t(result.maxIterations) + 1;
+    std::vector<std::vector<std::size_t>> histograms(numThreads, std::vector<std::size_t>(numBins, 0));
+    internal::_ParallelFor(numTasks, numThreads, [&](unsigned threadIdx, std::size_t task) {
+        const auto range = taskRange(task);
+        std::vector<std::size_t>& histogram = histograms[threadIdx];
+        for (std::size_t idx = range.first; idx < range.second; ++idx) {
+            if (positions[idx] >= 0.f)
+                ++histogram[std::min(numBins - 1, std::size_t(positions[idx]))];
+        }
+    });
+
+    // merged histogram and its prefix sum: cumulative[bin] = number of pixels within all lower bins
+    std::vector<std::size_t> counts(numBins, 0), cumulative(numBins + 1, 0);
+    for (const auto& histogram : histograms)
+        for (std::size_t bin = 0; bin < numBins; ++bin)
+            counts[bin] += histogram[bin];
+    for (std::size_t bin = 0; bin < numBins; ++bin)
+        cumulative[bin + 1] = cumulative[bin] + counts[bin];
+    if (!cumulative[numBins])
+        return positions;
+
+    // the fractional part interpolates within its bin
+    const float scale = (paletteSize - 1.f) / float(cumulative[numBins]);
+    internal::_ParallelFor(numTasks, numThreads, [&](unsigned, std::size_t task) {
+        const auto range = taskRange(task);
+        for (std::size_t idx = range.first; idx < range.second; ++idx) {
+            if (positions[idx] >= 0.f) {
+                const std::size_t bin = std::min(numBins - 1, std::size_t(positions[idx]));
+                const float fraction = std::min(1.f, positions[idx] - float(bin));
+                positions[idx] = (float(cumulative[bin]) + fraction * float(counts[bin])) * scale;
+            }
+        }
+    });
+    return positions;
+}
+
+void ColorMap::apply(const EscapeTime::Result& result, cv::Mat& image) const {
+    if (result.width != image.cols || result.height != image.rows || image.type() != CV_8UC3)
+        throw std::runtime_error(R"(Error: image has to be a BGR image of the size of the result in function "ColorMap::apply")");
+
+    const std::vector<float> positions = this->calculatePositions(result);
+    const std::size_t paletteSize = this->m_Red.size();
+    const bool cyclic = this->m_Scaling == Scaling::CYCLIC;
+    const int width = result.width;
+    const std::size_t numTasks = std::size_t(_NumTasks(result));
+
+    internal::_ParallelFor(numTasks, internal::_NumThreads(this->m_NumThreads, numTasks), [&](unsigned, std::size_t task) {
+        std::vector<int> lower(width), upper(width);
+        std::vector<float> fraction(width), red(width), green(width), blue(width);
+        for (int row = int(task) * ROWS_PER_TASK; row < std::min(result.height, int(task + 1) * ROWS_PER_TASK); ++row) {
+            const float* position = &positions[std::size_t(row) * width];
+
+            // neighbouring palette entries (the cyclic palette wraps around), inside pixels use entry 0 for now
+            for (int col = 0; col < width; ++col) {
+                const float p = std::max(0.f, position[col]);
+                lower[col] = int(p);
+                fraction[col] = p - float(lower[col]);
+                upper[col] = lower[col] + 1;
+            }
+            for (int col = 0; col < width; ++col)
+                upper[col] = upper[col] < int(paletteSize) ? upper[col] : (cyclic ? 0 : int(paletteSize) - 1);
+
+            for (int col = 0; col < width; ++col) {
+                const float t = fraction[col];
+                red[col] = this->m_Red[lower[col]] + t * (this->m_Red[upper[col]] - this->m_Red[lower[col]]);
+                green[col] = this->m_Green[lower[col]] + t * (this->m_Green[upper[col]] - this->m_Green[lower[col]]);
+                blue[col] = this->m_Blue[lower[col]] + t * (this->m_Blue[upper[col]] - this->m_Blue[lower[col]]);
+            }
+
+            cv::Vec3b* pixel = image.ptr<cv::Vec3b>(row);
+            for (int col = 0; col < width; ++col) {
+                const bool inside = position[col] < 0.f;
+                pixel[col][0] = inside ? this->m_InsideColor.b : uchar(blue[col] + 0.5f);
+                pixel[col][1] = inside ? this->m_InsideColor.g : uchar(green[col] + 0.5f);
+                pixel[col][2] = inside ? this->m_InsideColor.r : uchar(red[col] + 0.5f);
+            }
+        }
+    });
+}
+
+void ColorMap::render(const EscapeTime::Result& result, WindowVectorized& window) const {
+    this->apply(result, window.getImage());
+}
+} // namespace cf
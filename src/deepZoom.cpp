@@ -0,0 +1,241 @@
+#include "deepZoom.h"
+#include "internal.hpp"
+
+#include <cmath>
+
+namespace cf {
+
+namespace {
+constexpr const int TILE_SIZE = 32;
+constexpr const int GUARD_BITS = 64; // precision of the reference orbit beyond the pixel size
+constexpr const unsigned MAX_SERIES_TERMS = 16;
+
+// sum of coefficients[k] * x^(k + 1)
+std::complex<double> _EvaluateSeries(const std::vector<std::complex<double>>& coefficients, const std::complex<double>& x) {
+    std::complex<double> sum(0.0, 0.0);
+    for (std::size_t k = coefficients.size(); k-- > 0;)
+        sum = (sum + coefficients[k]) * x;
+    return sum;
+}
+} // namespace
+
+DeepZoom::DeepZoom(const std::string& centerReal, const std::string& centerImag, double viewWidth)
+    : m_CenterReal(centerReal), m_CenterImag(centerImag) {
+    this->setViewWidth(viewWidth);
+    // validate the center early
+    FixedPoint::FromString(centerReal, 64);
+    FixedPoint::FromString(centerImag, 64);
+}
+
+void DeepZoom::setMaxIterations(uint32_t maxIterations) {
+    if (!maxIterations)
+        throw std::runtime_error(R"(Error: at least one iteration is required in function "DeepZoom::setMaxIterations")");
+    this->m_MaxIterations = maxIterations;
+}
+void DeepZoom::setEscapeRadius(double radius) {
+    if (!(radius >= 2.0 && radius <= 1e50))
+        throw std::runtime_error(R"(Error: escape radius has to be within [2, 1e50] in function "DeepZoom::setEscapeRadius")");
+    this->m_EscapeRadius = radius;
+}
+void DeepZoom::setNumThreads(unsigned numThreads) { this->m_NumThreads = numThreads; }
+
+void DeepZoom::setSeriesApproximation(unsigned terms, double tolerance) {
+    if (terms == 1 || terms > MAX_SERIES_TERMS)
+        throw std::runtime_error(R"(Error: series approximation requires 0 (disabled) or 2 - 16 terms in function "DeepZoom::setSeriesApproximation")");
+    if (!(tolerance > 0.0))
+        throw std::runtime_error(R"(Error: tolerance has to be positive in function "DeepZoom::setSeriesApproximation")");
+    this->m_SeriesTerms = terms;
+    this->m_SeriesTolerance = tolerance;
+}
+
+void DeepZoom::setViewWidth(double viewWidth) {
+    if (!(viewWidth > 1e-290 && viewWidth < 1e10))
+        throw std::runtime_error(R"(Error: view width has to be within (1e-290, 1e10) in function "DeepZoom::setViewWidth")");
+    this->m_ViewWidth = viewWidth;
+}
+
+std::vector<std::complex<double>> DeepZoom::calculateReferenceOrbit() const {
+    const int bits = this->_fractionBits();
+    const FixedPoint cr = FixedPoint::FromString(this->m_CenterReal, bits);
+    const FixedPoint ci = FixedPoint::FromString(this->m_CenterImag, bits);
+    const double radius2 = this->m_EscapeRadius * this->m_EscapeRadius;
+
+    std::vector<std::complex<double>> orbit;
+    orbit.reserve(this->m_MaxIterations + 1);
+    orbit.emplace_back(0.0, 0.0);
+
+    FixedPoint zr(bits), zi(bits);
+    for (uint32_t i = 0; i < this->m_MaxIterations; ++i) {
+        const FixedPoint zr2 = zr * zr;
+        const FixedPoint zi2 = zi * zi;
+        zi = (zr * zi).mul2(1) + ci;
+        zr = zr2 - zi2 + cr;
+
+        orbit.emplace_back(zr.toDouble(), zi.toDouble());
+        if (std::norm(orbit.back()) > radius2)
+            break;
+    }
+    return orbit;
+}
+
+DeepZoom::Result DeepZoom::calculate(int width, int height) const {
+    if (width <= 0 || height <= 0)
+        throw std::runtime_error(R"(Error: invalid image size in function "DeepZoom::calculate")");
+
+    Result result;
+    result.width = width;
+    result.height = height;
+    result.maxIterations = this->m_MaxIterations;
+    result.escapeRadius = this->m_EscapeRadius;
+    result.iterations.resize(std::size_t(width) * std::size_t(height));
+    result.norms.resize(result.iterations.size());
+
+    const std::vector<std::complex<double>> reference = this->calculateReferenceOrbit();
+    const std::size_t referenceLength = reference.size();
+    result.referenceLength = referenceLength - 1;
+
+    const double pixelSize = this->m_ViewWidth / width;
+    const double radius2 = this->m_EscapeRadius * this->m_EscapeRadius;
+    const uint32_t maxIterations = this->m_MaxIterations;
+
+    // all pixels start at iteration 'skip'
+    const double seriesRadius = 0.5 * pixelSize * std::sqrt(double(width) * width + double(height) * height);
+    std::vector<std::complex<double>> coefficients;
+    const uint32_t skip = this->_seriesApproximation(reference, seriesRadius, width, height, coefficients);
+    result.skippedIterations = skip;
+
+    const int tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+    const int tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+    const unsigned numThreads = internal::_NumThreads(this->m_NumThreads, std::size_t(tilesX) * tilesY);
+    std::vector<std::size_t> rebases(numThreads, 0);
+
+    internal::_ParallelFor(std::size_t(tilesX) * tilesY, numThreads, [&](unsigned threadIdx, std::size_t tile) {
+        const int tileX = int(tile % tilesX) * TILE_SIZE;
+        const int tileY = int(tile / tilesX) * TILE_SIZE;
+
+        for (int row = tileY; row < std::min(height, tileY + TILE_SIZE); ++row) {
+            for (int col = tileX; col < std::min(width, tileX + TILE_SIZE); ++col) {
+                const double dcr = (col + 0.5 - 0.5 * width) * pixelSize;
+                const double dci = (0.5 * height - row - 0.5) * pixelSize;
+                double dr = 0.0, di = 0.0, zr = 0.0, zi = 0.0;
+                std::size_t ref = 0;
+                uint32_t iter = 0;
+                bool escaped = false;
+                if (skip) {
+                    const std::complex<double> d = _EvaluateSeries(coefficients, std::complex<double>(dcr, dci) / seriesRadius);
+                    dr = d.real();
+                    di = d.imag();
+                    ref = iter = skip;
+                    zr = reference[ref].real() + dr;
+                    zi = reference[ref].imag() + di;
+                    const double norm = zr * zr + zi * zi;
+                    escaped = norm > radius2;
+                    if (!escaped && (norm < dr * dr + di * di || ref + 1 == referenceLength)) {
+                        dr = zr;
+                        di = zi;
+                        ref = 0;
+                        ++rebases[threadIdx];
+                    }
+                }
+                while (!escaped && iter < maxIterations) {
+                    // d' = (2 * Z + d) * d + dc
+                    const double tr = 2.0 * reference[ref].real() + dr;
+                    const double ti = 2.0 * reference[ref].imag() + di;
+                    const double newDr = tr * dr - ti * di + dcr;
+                    di = tr * di + ti * dr + dci;
+                    dr = newDr;
+                    ++ref;
+                    ++iter;
+
+                    zr = reference[ref].real() + dr;
+                    zi = reference[ref].imag() + di;
+                    const double norm = zr * zr + zi * zi;
+                    if ((escaped = norm > radius2))
+                        break;
+
+                    // glitch or end of the reference orbit -> rebase
+                    if (norm < dr * dr + di * di || ref + 1 == referenceLength) {
+                        dr = zr;
+                        di = zi;
+                        ref = 0;
+                        ++rebases[threadIdx];
+                    }
+                }
+
+                const std::size_t idx = std::size_t(row) * width + col;
+                result.iterations[idx] = iter;
+                result.norms[idx] = zr * zr + zi * zi;
+            }
+        }
+    });
+
+    result.computedPixels = result.iterations.size();
+    for (const auto& i : result.iterations)
+        result.evaluations += i - skip;
+    for (const auto& r : rebases)
+        result.rebases += r;
+    return result;
+}
+
+void DeepZoom::render(WindowVectorized& window, const std::vector<Color>& palette, const Color& insideColor) const {
+    const Result result = this->calculate(window.getWidth(), window.getHeight());
+    EscapeTime::render(result, window, palette, insideColor);
+}
+
+uint32_t DeepZoom::_seriesApproximation(const std::vector<std::complex<double>>& reference, double radius, int width,
+                                        int height, std::vector<std::complex<double>>& coefficients) const {
+    const std::size_t numTerms = this->m_SeriesTerms;
+    coefficients.assign(numTerms, 0.0);
+    if (!numTerms)
+        return 0;
+
+    // probe pixels at the border of the view, they are iterated like all other pixels
+    const double pixelSize = this->m_ViewWidth / width;
+    std::vector<std::complex<double>> probes, probeDeltas;
+    for (const int row : {0, height / 2, height - 1}) {
+        for (const int col : {0, width / 2, width - 1}) {
+            if (row != height / 2 || col != width / 2)
+                probes.emplace_back((col + 0.5 - 0.5 * width) * pixelSize, (0.5 * height - row - 0.5) * pixelSize);
+        }
+    }
+    probeDeltas.assign(probes.size(), 0.0);
+
+    // the coefficients are scaled by radius^(k + 1) to avoid under-/overflows: the series is evaluated at dc / radius
+    const double tolerance = this->m_SeriesTolerance;
+    const double radius2 = this->m_EscapeRadius * this->m_EscapeRadius;
+    std::vector<std::complex<double>> next(numTerms);
+    uint32_t skip = 0;
+    for (std::size_t n = 0; n + 1 < reference.size(); ++n) {
+        const std::complex<double> twoZ = 2.0 * reference[n];
+        next[0] = twoZ * coefficients[0] + radius;
+        for (std::size_t k = 1; k < numTerms; ++k) {
+            std::complex<double> sum(0.0, 0.0);
+            for (std::size_t i = 0; i < k; ++i)
+                sum += coefficients[i] * coefficients[k - 1 - i];
+            next[k] = twoZ * coefficients[k] + sum;
+        }
+
+        // truncation error: the last term has to be negligible
+        if (!(std::abs(next[numTerms - 1]) <= tolerance * std::abs(next[numTerms - 2])))
+            break;
+
+        // the approximation has to match the iterated probes, which must neither escape nor be glitched
+        bool valid = true;
+        for (std::size_t p = 0; p < probes.size() && valid; ++p) {
+            std::complex<double>& d = probeDeltas[p];
+            d = (twoZ + d) * d + probes[p];
+            const double norm = std::norm(reference[n + 1] + d);
+            const std::complex<double> approximation = _EvaluateSeries(next, probes[p] / radius);
+            valid = norm <= radius2 && norm >= std::norm(d) && std::abs(approximation - d) <= tolerance * std::abs(d);
+        }
+        if (!valid)
+            break;
+
+        coefficients.swap(next);
+        skip = uint32_t(n + 1);
+    }
+    return skip;
+}
+
+int DeepZoom::_fractionBits() const { return std::max(64, int(std::ceil(-std::log2(this->m_ViewWidth))) + GUARD_BITS); }
+} // namespace cf
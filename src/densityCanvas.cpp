@@ -0,0 +1,77 @@
+#include "densityCanvas.h"
+
+#include <cmath>
+
+namespace cf {
+
+DensityCanvas::DensityCanvas(int width, int height, const Interval& range_x, const Interval& range_y)
+    : m_Width(width), m_Height(height), m_RangeX(range_x), m_RangeY(range_y) {
+    if (width <= 0 || height <= 0)
+        throw std::runtime_error("Error: invalid canvas size in function \"DensityCanvas::DensityCanvas\"");
+    if (range_x.min >= range_x.max || range_y.min >= range_y.max)
+        throw std::runtime_error("Error: intervals have to be in ascending order in function \"DensityCanvas::DensityCanvas\"");
+
+    this->m_ScaleX = double(width) / (double(range_x.max) - double(range_x.min));
+    this->m_ScaleY = double(height) / (double(range_y.max) - double(range_y.min));
+    this->m_Data.resize(std::size_t(width) * std::size_t(height), 0);
+}
+
+DensityCanvas::DensityCanvas(WindowVectorized& window)
+    : DensityCanvas(window.getWidth(), window.getHeight(), window.getIntervalX(), window.getIntervalY()) {}
+
+void DensityCanvas::clear() { std::fill(this->m_Data.begin(), this->m_Data.end(), 0); }
+
+int DensityCanvas::getWidth() const { return this->m_Width; }
+int DensityCanvas::getHeight() const { return this->m_Height; }
+const Interval& DensityCanvas::getRangeX() const { return this->m_RangeX; }
+const Interval& DensityCanvas::getRangeY() const { return this->m_RangeY; }
+
+std::vector<int> DensityCanvas::getLevels(int maxLevel, Normalization normalization) const {
+    // logarithmic scale factor per column (global normalization -> all columns share the same factor)
+    std::vector<float> scale(std::size_t(this->m_Width), 0.f);
+    uint32_t globalMax = 0;
+    for (int row = 0; row < this->m_Height; ++row) {
+        const uint32_t* data = this->getRow(row);
+        for (int col = 0; col < this->m_Width; ++col) {
+            scale[col] = std::max(scale[col], float(data[col]));
+            globalMax = std::max(globalMax, data[col]);
+        }
+    }
+    for (auto& s : scale) {
+        const float maxCount = normalization == Normalization::GLOBAL ? float(globalMax) : s;
+        s = maxCount > 0.f ? 1.f / std::log1p(maxCount) : 0.f;
+    }
+
+    std::vector<int> levels(this->m_Data.size(), 0);
+    for (int row = 0; row < this->m_Height; ++row) {
+        const uint32_t* data = this->getRow(row);
+        int* level = &levels[std::size_t(row) * this->m_Width];
+        for (int col = 0; col < this->m_Width; ++col) // rounded, the maximum has to reach 'maxLevel'
+            if (data[col])
+                level[col] = std::min(maxLevel, std::max(1, int(std::log1p(float(data[col])) * scale[col] * maxLevel + 0.5f)));
+    }
+    return levels;
+}
+
+void DensityCanvas::render(WindowVectorized& window, const std::vector<Color>& palette, Normalization normalization) const {
+    cv::Mat& image = window.getImage();
+    if (image.cols != this->m_Width || image.rows != this->m_Height)
+        throw std::runtime_error("Error: window and canvas size differ in function \"DensityCanvas::render\"");
+
+    const std::vector<int> levels = this->getLevels(palette.empty() ? 255 : int(palette.size()) - 1, normalization);
+    for (int row = 0; row < this->m_Height; ++row) {
+        const int* level = &levels[std::size_t(row) * this->m_Width];
+        cv::Vec3b* pixel = image.ptr<cv::Vec3b>(row);
+        for (int col = 0; col < this->m_Width; ++col) {
+            if (palette.empty()) {
+                pixel[col][0] = pixel[col][1] = pixel[col][2] = uint8_t(level[col]);
+            } else {
+                const Color& c = palette[std::size_t(level[col])];
+                pixel[col][0] = c.b;
+                pixel[col][1] = c.g;
+                pixel[col][2] = c.r;
+            }
+        }
+    }
+}
+} // namespace cf
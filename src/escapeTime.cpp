@@ -0,0 +1,606 @@
+#include "escapeTime.h"
+#include "internal.hpp"
+
+#include <cmath>
+
+namespace cf {
+
+namespace {
+constexpr const int LANES = EscapeTime::LANES;
+constexpr const int TILE_SIZE = 64;              // has to be a multiple of LANES
+constexpr const uint32_t BLOCK_ITERATIONS = 8;   // iterations between two "all lanes escaped" checks
+constexpr const int MIN_SUBDIVISION_AREA = 64;   // smaller rectangles are iterated completely (Mariani-Silver)
+constexpr const double DERIVATIVE_LIMIT = 1e200; // |dz| saturates here, 2 * z * dz stays finite for |z| <= 1e100
+
+/**
+ * @brief _Blend mask * a + (1 - mask) * b with a mask of 0.0 or 1.0, multi precision values are blended component wise
+ * (exact and without the cost of multi precision products)
+ */
+inline double _Blend(double mask, double a, double b) { return mask * a + (1.0 - mask) * b; }
+inline DoubleDouble _Blend(double mask, const DoubleDouble& a, const DoubleDouble& b) {
+    DoubleDouble result;
+    result.hi = _Blend(mask, a.hi, b.hi);
+    result.lo = _Blend(mask, a.lo, b.lo);
+    return result;
+}
+inline QuadDouble _Blend(double mask, const QuadDouble& a, const QuadDouble& b) {
+    QuadDouble result;
+    for (int i = 0; i < 4; ++i)
+        result.c[i] = _Blend(mask, a.c[i], b.c[i]);
+    return result;
+}
+
+/**
+ * @brief _TileSolver Iterates only a subset of the pixels of a tile and fills the rest (Mariani-Silver or boundary
+ * tracing), requested pixels are collected and iterated in lane groups
+ */
+template <typename _Real, typename _Kernel, typename _Lanes> struct _TileSolver {
+    _TileSolver(const _Kernel& kernel, EscapeTime::Result& result, std::vector<uint8_t>& known, const _Real& minX,
+                const _Real& maxY, double stepX, double stepY)
+        : kernel(kernel), result(result), known(known), minX(minX), maxY(maxY), stepX(stepX), stepY(stepY) {}
+
+    /**
+     * @brief request Marks the pixel to be iterated by the next call of 'flush' (known pixels are ignored)
+     */
+    void request(int col, int row) {
+        const std::size_t idx = std::size_t(row) * this->result.width + col;
+        if (!this->known[idx]) {
+            this->known[idx] = 1;
+            this->pending.push_back(idx);
+        }
+    }
+
+    void flush() {
+        _Real x[LANES], y[LANES];
+        _Lanes lanes;
+        const int width = this->result.width;
+        for (std::size_t first = 0; first < this->pending.size(); first += LANES) {
+            // an incomplete lane group repeats its last pixel
+            const std::size_t numLanes = std::min<std::size_t>(LANES, this->pending.size() - first);
+            for (std::size_t l = 0; l < std::size_t(LANES); ++l) {
+                const std::size_t idx = this->pending[first + std::min(l, numLanes - 1)];
+                x[l] = this->minX + _Real((int(idx % width) + 0.5) * this->stepX);
+                y[l] = this->maxY - _Real((int(idx / width) + 0.5) * this->stepY);
+            }
+
+            this->kernel(x, y, lanes);
+            for (std::size_t l = 0; l < numLanes; ++l) {
+                const std::size_t idx = this->pending[first + l];
+                this->result.iterations[idx] = lanes.iterations[l];
+                this->result.norms[idx] = lanes.norms[l];
+                if (!this->result.distances.empty())
+                    this->result.distances[idx] = lanes.distances[l];
+                this->evaluations += lanes.evaluations[l];
+            }
+        }
+        this->computedPixels += this->pending.size();
+        this->pending.clear();
+    }
+
+    /**
+     * @brief marianiSilver Fills or subdivides the rectangle [x0, x1] x [y0, y1], its border has to be known
+     */
+    void marianiSilver(int x0, int y0, int x1, int y1) {
+        if (x1 - x0 < 2 || y1 - y0 < 2)
+            return;
+
+        const int width = this->result.width;
+        const std::size_t first = std::size_t(y0) * width + x0;
+        const uint32_t value = this->result.iterations[first];
+        bool uniform = true;
+        for (int col = x0; col <= x1 && uniform; ++col)
+            uniform = this->result.iterations[std::size_t(y0) * width + col] == value &&
+                      this->result.iterations[std::size_t(y1) * width + col] == value;
+        for (int row = y0; row <= y1 && uniform; ++row)
+            uniform = this->result.iterations[std::size_t(row) * width + x0] == value &&
+                      this->result.iterations[std::size_t(row) * width + x1] == value;
+
+        if (uniform && this->fillable(value)) {
+            const double norm = this->result.norms[first];
+            for (int row = y0 + 1; row < y1; ++row) {
+                const std::size_t offset = std::size_t(row) * width;
+                std::fill(&this->result.iterations[offset + x0 + 1], &this->result.iterations[offset + x1], value);
+                std::fill(&this->result.norms[offset + x0 + 1], &this->result.norms[offset + x1], norm);
+                std::fill(&this->known[offset + x0 + 1], &this->known[offset + x1], uint8_t(1));
+                if (!this->result.distances.empty())
+                    std::fill(&this->result.distances[offset + x0 + 1], &this->result.distances[offset + x1], 0.f);
+            }
+            return;
+        }
+
+        if ((x1 - x0 - 1) * (y1 - y0 - 1) <= MIN_SUBDIVISION_AREA) {
+            for (int row = y0 + 1; row < y1; ++row)
+                for (int col = x0 + 1; col < x1; ++col)
+                    this->request(col, row);
+            this->flush();
+            return;
+        }
+
+        // split the longer side, the dividing line becomes part of both borders
+        if (x1 - x0 >= y1 - y0) {
+            const int mid = (x0 + x1) / 2;
+            for (int row = y0 + 1; row < y1; ++row)
+                this->request(mid, row);
+            this->flush();
+            this->marianiSilver(x0, y0, mid, y1);
+            this->marianiSilver(mid, y0, x1, y1);
+        } else {
+            const int mid = (y0 + y1) / 2;
+            for (int col = x0 + 1; col < x1; ++col)
+                this->request(col, mid);
+            this->flush();
+            this->marianiSilver(x0, y0, x1, mid);
+            this->marianiSilver(x0, mid, x1, y1);
+        }
+    }
+
+    /**
+     * @brief boundaryTrace Traces all borders between different iteration counts within [x0, x1] x [y0, y1] starting
+     * at the rectangle border, the enclosed (not iterated) pixels are filled afterwards
+     *
+     * the traced pixels are processed in waves, all pixels of a wave and their neighbours are iterated together
+     */
+    void boundaryTrace(int x0, int y0, int x1, int y1) {
+        const int width = this->result.width;
+        const int tileWidth = x1 - x0 + 1;
+        std::vector<uint8_t> queued(std::size_t(tileWidth) * (y1 - y0 + 1), 0);
+        std::vector<std::size_t> wave, nextWave;
+        auto enqueue = [&](int col, int row, std::vector<std::size_t>& target) {
+            uint8_t& q = queued[std::size_t(row - y0) * tileWidth + col - x0];
+            if (!q) {
+                q = 1;
+                target.push_back(std::size_t(row) * width + col);
+            }
+        };
+        for (int col = x0; col <= x1; ++col) {
+            enqueue(col, y0, wave);
+            enqueue(col, y1, wave);
+        }
+        for (int row = y0; row <= y1; ++row) {
+            enqueue(x0, row, wave);
+            enqueue(x1, row, wave);
+        }
+
+        const std::vector<uint32_t>& it = this->result.iterations;
+        while (!wave.empty()) {
+            for (const auto& idx : wave) {
+                const int col = int(idx % width), row = int(idx / width);
+                this->request(col, row);
+                if (col > x0)
+                    this->request(col - 1, row);
+                if (col < x1)
+                    this->request(col + 1, row);
+                if (row > y0)
+                    this->request(col, row - 1);
+                if (row < y1)
+                    this->request(col, row + 1);
+            }
+            this->flush();
+
+            // neighbours with a different iteration count are part of a border, which is followed further
+            nextWave.clear();
+            for (const auto& idx : wave) {
+                const int col = int(idx % width), row = int(idx / width);
+                const uint32_t center = it[idx];
+                const bool l = col > x0 && it[idx - 1] != center;
+                const bool r = col < x1 && it[idx + 1] != center;
+                const bool u = row > y0 && it[idx - width] != center;
+                const bool d = row < y1 && it[idx + width] != center;
+                if (l)
+                    enqueue(col - 1, row, nextWave);
+                if (r)
+                    enqueue(col + 1, row, nextWave);
+                if (u)
+                    enqueue(col, row - 1, nextWave);
+                if (d)
+                    enqueue(col, row + 1, nextWave);
+                if ((l || u) && col > x0 && row > y0)
+                    enqueue(col - 1, row - 1, nextWave);
+                if ((r || u) && col < x1 && row > y0)
+                    enqueue(col + 1, row - 1, nextWave);
+                if ((l || d) && col > x0 && row < y1)
+                    enqueue(col - 1, row + 1, nextWave);
+                if ((r || d) && col < x1 && row < y1)
+                    enqueue(col + 1, row + 1, nextWave);
+            }
+            wave.swap(nextWave);
+        }
+
+        // every unknown pixel is enclosed by pixels of its own region, whose value is the one of the last known pixel
+        // of the row (the left border is always known)
+        for (int row = y0 + 1; row < y1; ++row) {
+            const std::size_t offset = std::size_t(row) * width;
+            std::size_t region = offset + x0;
+            for (int col = x0 + 1; col < x1; ++col) {
+                if (this->known[offset + col])
+                    region = offset + col;
+                else if (this->fillable(it[region])) {
+                    this->known[offset + col] = 1;
+                    this->result.iterations[offset + col] = it[region];
+                    this->result.norms[offset + col] = this->result.norms[region];
+                    if (!this->result.distances.empty())
+                        this->result.distances[offset + col] = 0.f;
+                } else
+                    this->request(col, row);
+            }
+        }
+        this->flush();
+    }
+
+    /**
+     * @brief fillable Regions of equal iteration count can be filled, unless their distance estimates are required
+     */
+    bool fillable(uint32_t value) const { return this->result.distances.empty() || value >= this->result.maxIterations; }
+
+    const _Kernel& kernel;
+    EscapeTime::Result& result;
+    std::vector<uint8_t>& known;
+    const _Real minX, maxY;
+    const double stepX, stepY;
+    std::vector<std::size_t> pending;
+    std::size_t evaluations = 0;
+    std::size_t computedPixels = 0;
+};
+} // namespace
+
+EscapeTime::EscapeTime() = default;
+
+EscapeTime EscapeTime::Julia(const std::complex<double>& c) {
+    EscapeTime fractal;
+    fractal.m_Julia = true;
+    fractal.m_JuliaC = c;
+    return fractal;
+}
+
+void EscapeTime::setMaxIterations(uint32_t maxIterations) {
+    if (!maxIterations)
+        throw std::runtime_error(R"(Error: at least one iteration is required in function "EscapeTime::setMaxIterations")");
+    this->m_MaxIterations = maxIterations;
+}
+uint32_t EscapeTime::getMaxIterations() const { return this->m_MaxIterations; }
+void EscapeTime::setEscapeRadius(double radius) {
+    // escaped lanes are squared once more before being masked out, which must not overflow
+    if (!(radius > 0.0 && radius <= 1e50))
+        throw std::runtime_error(R"(Error: escape radius has to be within (0, 1e50] in function "EscapeTime::setEscapeRadius")");
+    this->m_EscapeRadius = radius;
+}
+double EscapeTime::getEscapeRadius() const { return this->m_EscapeRadius; }
+void EscapeTime::setNumThreads(unsigned numThreads) { this->m_NumThreads = numThreads; }
+void EscapeTime::setMode(Mode mode) { this->m_Mode = mode; }
+void EscapeTime::setPrecision(Precision precision) { this->m_Precision = precision; }
+
+void EscapeTime::setInteriorDetection(bool enabled, double periodicityTolerance) {
+    if (!(periodicityTolerance >= 0.0 && periodicityTolerance < 1.0))
+        throw std::runtime_error(R"(Error: periodicity tolerance has to be within [0, 1) in function "EscapeTime::setInteriorDetection")");
+    this->m_InteriorDetection = enabled;
+    this->m_PeriodicityTolerance = periodicityTolerance;
+}
+void EscapeTime::setDistanceEstimation(bool enabled) { this->m_DistanceEstimation = enabled; }
+
+EscapeTime::Result EscapeTime::calculate(int width, int height, const Interval& range_x, const Interval& range_y) const {
+    if (width <= 0 || height <= 0)
+        throw std::runtime_error(R"(Error: invalid image size in function "EscapeTime::calculate")");
+
+    const double stepX = (double(range_x.max) - double(range_x.min)) / width;
+    const double stepY = (double(range_y.max) - double(range_y.min)) / height;
+    switch (this->m_Precision) {
+    case Precision::DOUBLE_DOUBLE:
+        return this->_calculate(width, height, DoubleDouble(range_x.min), DoubleDouble(range_y.max), stepX, stepY);
+    case Precision::QUAD_DOUBLE:
+        return this->_calculate(width, height, QuadDouble(range_x.min), QuadDouble(range_y.max), stepX, stepY);
+    default:
+        return this->_calculate(width, height, double(range_x.min), double(range_y.max), stepX, stepY);
+    }
+}
+
+EscapeTime::Result EscapeTime::calculate(int width, int height, const QuadDouble& centerReal, const QuadDouble& centerImag,
+                                         double viewWidth) const {
+    if (width <= 0 || height <= 0)
+        throw std::runtime_error(R"(Error: invalid image size in function "EscapeTime::calculate")");
+    if (!(viewWidth > 0.0))
+        throw std::runtime_error(R"(Error: view width has to be positive in function "EscapeTime::calculate")");
+
+    const double step = viewWidth / width;
+    const QuadDouble minX = centerReal - QuadDouble(0.5 * width * step);
+    const QuadDouble maxY = centerImag + QuadDouble(0.5 * height * step);
+    switch (this->m_Precision) {
+    case Precision::DOUBLE_DOUBLE:
+        return this->_calculate(width, height, DoubleDouble(minX), DoubleDouble(maxY), step, step);
+    case Precision::QUAD_DOUBLE:
+        return this->_calculate(width, height, minX, maxY, step, step);
+    default:
+        return this->_calculate(width, height, double(minX), double(maxY), step, step);
+    }
+}
+
+template <typename _Real>
+EscapeTime::Result EscapeTime::_calculate(int width, int height, const _Real& minX, const _Real& maxY, double stepX,
+                                          double stepY) const {
+    Result result;
+    result.width = width;
+    result.height = height;
+    result.maxIterations = this->m_MaxIterations;
+    result.escapeRadius = this->m_EscapeRadius;
+    result.iterations.resize(std::size_t(width) * std::size_t(height));
+    result.norms.resize(result.iterations.size());
+    if (this->m_DistanceEstimation)
+        result.distances.resize(result.iterations.size());
+
+    const int tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+    const int tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+    const unsigned numThreads = internal::_NumThreads(this->m_NumThreads, std::size_t(tilesX) * tilesY);
+    std::vector<std::size_t> evaluations(numThreads, 0);
+    std::vector<std::size_t> computedPixels(numThreads, 0);
+
+    // tiles do not overlap, every thread only accesses the pixels of its current tile
+    std::vector<uint8_t> known(this->m_Mode == Mode::FULL ? 0 : result.iterations.size(), 0);
+    const auto kernel = [this](const _Real* x, const _Real* y, _Lanes& lanes) { this->_calculateLanes(x, y, lanes); };
+
+    internal::_ParallelFor(std::size_t(tilesX) * tilesY, numThreads, [&](unsigned threadIdx, std::size_t tile) {
+        const int tileX = int(tile % tilesX) * TILE_SIZE;
+        const int tileY = int(tile / tilesX) * TILE_SIZE;
+        const int endX = std::min(width, tileX + TILE_SIZE);
+        const int endY = std::min(height, tileY + TILE_SIZE);
+
+        if (this->m_Mode != Mode::FULL) {
+            _TileSolver<_Real, decltype(kernel), _Lanes> solver(kernel, result, known, minX, maxY, stepX, stepY);
+            if (this->m_Mode == Mode::MARIANI_SILVER) {
+                for (int col = tileX; col < endX; ++col) {
+                    solver.request(col, tileY);
+                    solver.request(col, endY - 1);
+                }
+                for (int row = tileY; row < endY; ++row) {
+                    solver.request(tileX, row);
+                    solver.request(endX - 1, row);
+                }
+                solver.flush();
+                solver.marianiSilver(tileX, tileY, endX - 1, endY - 1);
+            } else
+                solver.boundaryTrace(tileX, tileY, endX - 1, endY - 1);
+
+            evaluations[threadIdx] += solver.evaluations;
+            computedPixels[threadIdx] += solver.computedPixels;
+            return;
+        }
+
+        _Real x[LANES], y[LANES];
+        _Lanes lanes;
+        for (int row = tileY; row < endY; ++row) {
+            std::fill(y, y + LANES, maxY - _Real((row + 0.5) * stepY));
+            for (int col = tileX; col < endX; col += LANES) {
+                // the last lane group of a row may be incomplete, those lanes repeat the last column
+                for (int l = 0; l < LANES; ++l)
+                    x[l] = minX + _Real((std::min(col + l, width - 1) + 0.5) * stepX);
+
+                this->_calculateLanes(x, y, lanes);
+                const int numLanes = std::min(LANES, endX - col);
+                const std::size_t offset = std::size_t(row) * width + col;
+                std::copy(lanes.iterations, lanes.iterations + numLanes, &result.iterations[offset]);
+                std::copy(lanes.norms, lanes.norms + numLanes, &result.norms[offset]);
+                if (this->m_DistanceEstimation)
+                    std::copy(lanes.distances, lanes.distances + numLanes, &result.distances[offset]);
+                for (int l = 0; l < numLanes; ++l)
+                    evaluations[threadIdx] += lanes.evaluations[l];
+                computedPixels[threadIdx] += std::size_t(numLanes);
+            }
+        }
+    });
+
+    for (unsigned t = 0; t < numThreads; ++t) {
+        result.evaluations += evaluations[t];
+        result.computedPixels += computedPixels[t];
+    }
+    return result;
+}
+
+EscapeTime::Result EscapeTime::calculate(const std::vector<std::complex<double>>& points) const {
+    Result result;
+    result.width = int(points.size());
+    result.height = 1;
+    result.maxIterations = this->m_MaxIterations;
+    result.escapeRadius = this->m_EscapeRadius;
+    result.iterations.resize(points.size());
+    result.norms.resize(points.size());
+    if (this->m_DistanceEstimation)
+        result.distances.resize(points.size());
+    result.computedPixels = points.size();
+    if (points.empty())
+        return result;
+
+    // chunks of the size of a tile
+    constexpr const std::size_t CHUNK_SIZE = std::size_t(TILE_SIZE) * TILE_SIZE;
+    const std::size_t numChunks = (points.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    const unsigned numThreads = internal::_NumThreads(this->m_NumThreads, numChunks);
+    std::vector<std::size_t> evaluations(numThreads, 0);
+
+    internal::_ParallelFor(numChunks, numThreads, [&](unsigned threadIdx, std::size_t chunk) {
+        const std::size_t end = std::min(points.size(), (chunk + 1) * CHUNK_SIZE);
+        double x[LANES], y[LANES];
+        _Lanes lanes;
+        for (std::size_t first = chunk * CHUNK_SIZE; first < end; first += LANES) {
+            // an incomplete lane group repeats its last point
+            const std::size_t numLanes = std::min<std::size_t>(LANES, end - first);
+            for (std::size_t l = 0; l < std::size_t(LANES); ++l) {
+                x[l] = points[first + std::min(l, numLanes - 1)].real();
+                y[l] = points[first + std::min(l, numLanes - 1)].imag();
+            }
+
+            this->_calculateLanes(x, y, lanes);
+            std::copy(lanes.iterations, lanes.iterations + numLanes, &result.iterations[first]);
+            std::copy(lanes.norms, lanes.norms + numLanes, &result.norms[first]);
+            if (this->m_DistanceEstimation)
+                std::copy(lanes.distances, lanes.distances + numLanes, &result.distances[first]);
+            for (std::size_t l = 0; l < numLanes; ++l)
+                evaluations[threadIdx] += lanes.evaluations[l];
+        }
+    });
+
+    for (const auto& e : evaluations)
+        result.evaluations += e;
+    return result;
+}
+
+void EscapeTime::render(WindowVectorized& window, const std::vector<Color>& palette, const Color& insideColor) const {
+    cv::Mat& image = window.getImage();
+    EscapeTime::render(this->calculate(image.cols, image.rows, window.getIntervalX(), window.getIntervalY()), window, palette,
+                       insideColor);
+}
+
+void EscapeTime::render(const Result& result, WindowVectorized& window, const std::vector<Color>& palette,
+                        const Color& insideColor) {
+    cv::Mat& image = window.getImage();
+    if (palette.empty())
+        throw std::runtime_error(R"(Error: empty palette in function "EscapeTime::render")");
+    if (result.width != image.cols || result.height != image.rows)
+        throw std::runtime_error(R"(Error: window and result size differ in function "EscapeTime::render")");
+
+    for (int row = 0; row < image.rows; ++row) {
+        const std::size_t offset = std::size_t(row) * image.cols;
+        cv::Vec3b* pixel = image.ptr<cv::Vec3b>(row);
+        for (int col = 0; col < image.cols; ++col) {
+            const Color& c = result.isInside(offset + col) ? insideColor : palette[result.iterations[offset + col] % palette.size()];
+            pixel[col][0] = c.b;
+            pixel[col][1] = c.g;
+            pixel[col][2] = c.r;
+        }
+    }
+}
+
+void EscapeTime::renderDistance(const Result& result, WindowVectorized& window, const Color& boundaryColor,
+                                const Color& exteriorColor, double thickness) {
+    cv::Mat& image = window.getImage();
+    if (result.distances.size() != result.iterations.size())
+        throw std::runtime_error(R"(Error: result without distance estimates in function "EscapeTime::renderDistance")");
+    if (result.width != image.cols || result.height != image.rows)
+        throw std::runtime_error(R"(Error: window and result size differ in function "EscapeTime::renderDistance")");
+    if (!(thickness > 0.0))
+        throw std::runtime_error(R"(Error: thickness has to be positive in function "EscapeTime::renderDistance")");
+
+    // distance in pixels -> blend factor, sqrt gives a sharp but anti aliased border
+    const double pixelSize = (double(window.getIntervalX().max) - double(window.getIntervalX().min)) / image.cols;
+    const float scale = float(1.0 / (pixelSize * thickness));
+    for (int row = 0; row < image.rows; ++row) {
+        const float* distance = &result.distances[std::size_t(row) * image.cols];
+        cv::Vec3b* pixel = image.ptr<cv::Vec3b>(row);
+        for (int col = 0; col < image.cols; ++col) {
+            const float t = std::sqrt(std::min(1.f, distance[col] * scale));
+            pixel[col][0] = uchar(boundaryColor.b + t * (exteriorColor.b - boundaryColor.b) + 0.5f);
+            pixel[col][1] = uchar(boundaryColor.g + t * (exteriorColor.g - boundaryColor.g) + 0.5f);
+            pixel[col][2] = uchar(boundaryColor.r + t * (exteriorColor.r - boundaryColor.r) + 0.5f);
+        }
+    }
+}
+
+template <typename _Real> void EscapeTime::_calculateLanes(const _Real* x, const _Real* y, _Lanes& lanes) const {
+    if (this->m_DistanceEstimation)
+        this->_iterateLanes<_Real, true>(x, y, lanes);
+    else
+        this->_iterateLanes<_Real, false>(x, y, lanes);
+}
+
+template <typename _Real, bool DERIVATIVE>
+void EscapeTime::_iterateLanes(const _Real* x, const _Real* y, _Lanes& lanes) const {
+    // z and c in the precision of the calculation, masks, counters and the derivative in double precision
+    _Real zr[LANES], zi[LANES], cr[LANES], ci[LANES], savedR[LANES], savedI[LANES];
+    double count[LANES], active[LANES], inside[LANES], dzr[LANES], dzi[LANES];
+    const double derivativeOffset = this->m_Julia ? 0.0 : 1.0; // dz/dc of the Mandelbrot set, dz/dz_0 of Julia sets
+    for (int l = 0; l < LANES; ++l) {
+        dzr[l] = 1.0 - derivativeOffset;
+        dzi[l] = 0.0;
+        zr[l] = this->m_Julia ? x[l] : _Real(0.0);
+        zi[l] = this->m_Julia ? y[l] : _Real(0.0);
+        cr[l] = this->m_Julia ? _Real(this->m_JuliaC.real()) : x[l];
+        ci[l] = this->m_Julia ? _Real(this->m_JuliaC.imag()) : y[l];
+        count[l] = 0.0;
+        inside[l] = 0.0;
+        savedR[l] = zr[l];
+        savedI[l] = zi[l];
+    }
+
+    // main cardioid: q * (q + x - 1/4) <= y^2 / 4 with q = (x - 1/4)^2 + y^2, period-2 bulb: (x + 1)^2 + y^2 <= 1/16
+    if (this->m_InteriorDetection && !this->m_Julia) {
+        for (int l = 0; l < LANES; ++l) {
+            // evaluated in the precision of the calculation (deep views close to the boundary)
+            const _Real y2 = ci[l] * ci[l];
+            const _Real x4 = cr[l] - _Real(0.25);
+            const _Real q = x4 * x4 + y2;
+            const double cardioid = 0.5 + 0.5 * std::copysign(1.0, double(y2 * 0.25 - q * (q + x4)));
+            const _Real x1 = cr[l] + _Real(1.0);
+            const double bulb = 0.5 + 0.5 * std::copysign(1.0, double(_Real(0.0625) - (x1 * x1 + y2)));
+            inside[l] = cardioid + bulb - cardioid * bulb;
+        }
+    }
+    double anyActive = 0.0;
+    for (int l = 0; l < LANES; ++l) {
+        active[l] = 1.0 - inside[l];
+        anyActive += active[l];
+    }
+
+    // branch free lane loop: escaped lanes keep their last value and stop counting,
+    // the lane mask (1.0 -> active, 0.0 -> escaped) is built and applied arithmetically (exact for finite values),
+    // comparisons and conditional moves would prevent the vectorization
+    //
+    // periodicity check: after every block the orbit is compared with a value saved at exponentially growing
+    // intervals (Brent), active lanes returning to the saved value are moved from 'active' to 'inside',
+    // comparing only block ends detects a cycle of length p as soon as the interval reaches BLOCK_ITERATIONS * p
+    const double radius2 = this->m_EscapeRadius * this->m_EscapeRadius;
+    const double tolerance2 = this->m_InteriorDetection && this->m_PeriodicityTolerance > 0.0
+                                  ? this->m_PeriodicityTolerance * this->m_PeriodicityTolerance
+                                  : -1.0;
+    uint64_t checkpoint = BLOCK_ITERATIONS;
+    for (uint32_t iter = 0; iter < this->m_MaxIterations && anyActive != 0.0;) {
+        const uint32_t blockEnd = std::min(this->m_MaxIterations, iter + BLOCK_ITERATIONS);
+        for (; iter < blockEnd; ++iter) {
+            for (int l = 0; l < LANES; ++l) {
+                const _Real zr2 = zr[l] * zr[l];
+                const _Real zi2 = zi[l] * zi[l];
+                active[l] *= 0.5 + 0.5 * std::copysign(1.0, radius2 - double(zr2 + zi2));
+                const _Real newZr = zr2 - zi2 + cr[l];
+                const _Real newZi = 2.0 * zr[l] * zi[l] + ci[l];
+                if (DERIVATIVE) {
+                    // dz' = 2 * z * dz (+ 1), saturated to stay finite (blending infinite values would result in NaN),
+                    // the saturation factor rounds to 1 for |dz| < 1e184 (fmin/fmax would prevent the vectorization)
+                    const double r = double(zr[l]), i = double(zi[l]);
+                    const double newDzr = 2.0 * (r * dzr[l] - i * dzi[l]) + derivativeOffset;
+                    const double newDzi = 2.0 * (r * dzi[l] + i * dzr[l]);
+                    const double saturation = 1.0 / (1.0 + (std::abs(newDzr) + std::abs(newDzi)) / DERIVATIVE_LIMIT);
+                    dzr[l] = _Blend(active[l], saturation * newDzr, dzr[l]);
+                    dzi[l] = _Blend(active[l], saturation * newDzi, dzi[l]);
+                }
+                zr[l] = _Blend(active[l], newZr, zr[l]);
+                zi[l] = _Blend(active[l], newZi, zi[l]);
+                count[l] += active[l];
+            }
+        }
+
+        for (int l = 0; l < LANES; ++l) {
+            const double dr = double(zr[l] - savedR[l]);
+            const double di = double(zi[l] - savedI[l]);
+            const double periodic = active[l] * (0.5 + 0.5 * std::copysign(1.0, tolerance2 - (dr * dr + di * di)));
+            inside[l] += periodic;
+            active[l] -= periodic;
+        }
+        if (iter >= checkpoint) {
+            std::copy(zr, zr + LANES, savedR);
+            std::copy(zi, zi + LANES, savedI);
+            checkpoint *= 2;
+        }
+
+        anyActive = 0.0;
+        for (int l = 0; l < LANES; ++l)
+            anyActive += active[l];
+    }
+
+    for (int l = 0; l < LANES; ++l) {
+        lanes.evaluations[l] = uint32_t(count[l]);
+        lanes.iterations[l] = inside[l] != 0.0 ? this->m_MaxIterations : lanes.evaluations[l];
+        const double norm = double(zr[l]) * double(zr[l]) + double(zi[l]) * double(zi[l]);
+        lanes.norms[l] = norm;
+        if (DERIVATIVE) {
+            const bool escaped = lanes.iterations[l] < this->m_MaxIterations && norm > 1.0;
+            lanes.distances[l] =
+                escaped ? float(0.5 * std::sqrt(norm) * std::log(norm) / std::sqrt(dzr[l] * dzr[l] + dzi[l] * dzi[l])) : 0.f;
+        }
+    }
+}
+} // namespace cf
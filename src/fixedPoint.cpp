@@ -0,0 +1,140 @@
+#include "fixedPoint.h"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace cf {
+
+namespace {
+constexpr const int BLOCK_BITS = int(sizeof(BigUnsigned::Blk) * 8);
+
+BigUnsigned _FromUint64(uint64_t v) {
+    BigUnsigned result;
+    for (int i = 0; v; ++i, v = BLOCK_BITS < 64 ? v >> BLOCK_BITS : 0)
+        result.setBlock(BigUnsigned::Index(i), BigUnsigned::Blk(v));
+    return result;
+}
+
+uint64_t _ToUint64(const BigUnsigned& v) {
+    uint64_t result = 0;
+    for (int i = 0; i * BLOCK_BITS < 64; ++i)
+        result |= uint64_t(v.getBlock(BigUnsigned::Index(i))) << (i * BLOCK_BITS);
+    return result;
+}
+
+BigUnsigned _Shift(const BigUnsigned& v, int bits) { return bits >= 0 ? v << bits : v >> -bits; }
+
+BigInteger _Shift(const BigInteger& v, int bits) {
+    if (v.getSign() == BigInteger::zero)
+        return v;
+    return BigInteger(_Shift(v.getMagnitude(), bits), v.getSign());
+}
+} // namespace
+
+FixedPoint::FixedPoint(int fractionBits) : m_FractionBits(fractionBits) {
+    if (fractionBits < 0)
+        throw std::runtime_error(R"(Error: negative number of fraction bits in function "FixedPoint::FixedPoint")");
+}
+
+FixedPoint::FixedPoint(double value, int fractionBits) : FixedPoint(fractionBits) {
+    if (!std::isfinite(value))
+        throw std::runtime_error(R"(Error: non finite value in function "FixedPoint::FixedPoint")");
+    if (value == 0.0)
+        return;
+
+    // value = mantissa * 2^(exponent - 53) with an integral 53 bit mantissa (exact)
+    int exponent;
+    const double mantissa = std::frexp(std::abs(value), &exponent);
+    const BigUnsigned magnitude = _Shift(_FromUint64(uint64_t(std::ldexp(mantissa, 53))), exponent - 53 + fractionBits);
+    if (!magnitude.isZero())
+        this->m_Mantissa = BigInteger(magnitude, value < 0.0 ? BigInteger::negative : BigInteger::positive);
+}
+
+FixedPoint FixedPoint::FromString(const std::string& decimal, int fractionBits) {
+    std::size_t pos = 0;
+    bool negative = false;
+    if (pos < decimal.size() && (decimal[pos] == '-' || decimal[pos] == '+'))
+        negative = decimal[pos++] == '-';
+
+    // collect all digits, 'digits' = integer * 10^-numDecimals
+    std::string digits;
+    std::size_t numDecimals = 0;
+    bool point = false;
+    for (; pos < decimal.size(); ++pos) {
+        const char c = decimal[pos];
+        if (c >= '0' && c <= '9') {
+            digits.push_back(c);
+            numDecimals += point;
+        } else if (c == '.' && !point)
+            point = true;
+        else
+            throw std::runtime_error("Error: invalid decimal number \"" + decimal + R"(" in function "FixedPoint::FromString")");
+    }
+    if (digits.empty())
+        throw std::runtime_error("Error: invalid decimal number \"" + decimal + R"(" in function "FixedPoint::FromString")");
+
+    BigUnsigned power = 1;
+    for (std::size_t i = 0; i < numDecimals; ++i)
+        power *= 10;
+
+    FixedPoint result(fractionBits);
+    const BigUnsigned magnitude = (stringToBigUnsigned(digits) << fractionBits) / power;
+    if (!magnitude.isZero())
+        result.m_Mantissa = BigInteger(magnitude, negative ? BigInteger::negative : BigInteger::positive);
+    return result;
+}
+
+FixedPoint FixedPoint::operator+(const FixedPoint& other) const { return FixedPoint(*this) += other; }
+FixedPoint FixedPoint::operator-(const FixedPoint& other) const { return FixedPoint(*this) -= other; }
+FixedPoint FixedPoint::operator*(const FixedPoint& other) const { return FixedPoint(*this) *= other; }
+
+FixedPoint FixedPoint::operator-() const {
+    FixedPoint result(*this);
+    result.m_Mantissa = -this->m_Mantissa;
+    return result;
+}
+
+FixedPoint& FixedPoint::operator+=(const FixedPoint& other) {
+    this->_checkFractionBits(other);
+    this->m_Mantissa += other.m_Mantissa;
+    return *this;
+}
+
+FixedPoint& FixedPoint::operator-=(const FixedPoint& other) {
+    this->_checkFractionBits(other);
+    this->m_Mantissa -= other.m_Mantissa;
+    return *this;
+}
+
+FixedPoint& FixedPoint::operator*=(const FixedPoint& other) {
+    this->_checkFractionBits(other);
+    this->m_Mantissa = _Shift(this->m_Mantissa * other.m_Mantissa, -this->m_FractionBits);
+    return *this;
+}
+
+FixedPoint FixedPoint::mul2(int exponent) const {
+    FixedPoint result(*this);
+    result.m_Mantissa = _Shift(this->m_Mantissa, exponent);
+    return result;
+}
+
+double FixedPoint::toDouble() const {
+    if (this->m_Mantissa.getSign() == BigInteger::zero)
+        return 0.0;
+
+    // only the 64 most significant bits are relevant
+    const BigUnsigned& magnitude = this->m_Mantissa.getMagnitude();
+    const int shift = std::max(0, int(magnitude.bitLength()) - 64);
+    const double value = std::ldexp(double(_ToUint64(_Shift(magnitude, -shift))), shift - this->m_FractionBits);
+    return this->m_Mantissa.getSign() == BigInteger::negative ? -value : value;
+}
+
+int FixedPoint::getFractionBits() const { return this->m_FractionBits; }
+const BigInteger& FixedPoint::getMantissa() const { return this->m_Mantissa; }
+
+void FixedPoint::_checkFractionBits(const FixedPoint& other) const {
+    if (this->m_FractionBits != other.m_FractionBits)
+        throw std::runtime_error(R"(Error: different number of fraction bits in function "FixedPoint")");
+}
+} // namespace cf
@@ -0,0 +1,28 @@
+#include "formulaFractal.h"
+
+namespace cf {
+
+void RootBasins::render(const RootBasins& basins, WindowVectorized& window, const std::vector<Color>& palette,
+                        double shading, const Color& notConverged) {
+    cv::Mat& image = window.getImage();
+    if (palette.empty())
+        throw std::runtime_error(R"(Error: empty palette in function "RootBasins::render")");
+    if (basins.width != image.cols || basins.height != image.rows)
+        throw std::runtime_error(R"(Error: window and result size differ in function "RootBasins::render")");
+    if (!(shading >= 0.0))
+        throw std::runtime_error(R"(Error: shading must not be negative in function "RootBasins::render")");
+
+    for (int row = 0; row < image.rows; ++row) {
+        const std::size_t offset = std::size_t(row) * image.cols;
+        cv::Vec3b* pixel = image.ptr<cv::Vec3b>(row);
+        for (int col = 0; col < image.cols; ++col) {
+            const int32_t root = basins.roots[offset + col];
+            const Color& c = root < 0 ? notConverged : palette[std::size_t(root) % palette.size()];
+            const double brightness = root < 0 ? 1.0 : 1.0 / (1.0 + shading * basins.iterations[offset + col]);
+            pixel[col][0] = uchar(c.b * brightness + 0.5);
+            pixel[col][1] = uchar(c.g * brightness + 0.5);
+            pixel[col][2] = uchar(c.r * brightness + 0.5);
+        }
+    }
+}
+} // namespace cf
@@ -0,0 +1,444 @@
+#include "hashLife.h"
+
+#include <array>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+
+namespace cf {
+
+namespace {
+constexpr const std::size_t MIN_TABLE_SIZE = std::size_t(1) << 16; // power of two
+constexpr const uint8_t FREE_LEVEL = 0xFF;                         // level of collected nodes
+
+/**
+ * @brief _LeafTable Center 2 x 2 cells of a 4 x 4 block (bit y * 4 + x) after one generation (bit y * 2 + x)
+ */
+const std::array<uint8_t, 1 << 16>& _LeafTable() {
+    static const std::array<uint8_t, 1 << 16> table = []() {
+        std::array<uint8_t, 1 << 16> t;
+        for (uint32_t block = 0; block < (1u << 16); ++block) {
+            uint8_t result = 0;
+            for (int y = 1; y <= 2; ++y) {
+                for (int x = 1; x <= 2; ++x) {
+                    int count = 0;
+                    for (int dy = -1; dy <= 1; ++dy)
+                        for (int dx = -1; dx <= 1; ++dx)
+                            count += (dx || dy) && ((block >> ((y + dy) * 4 + x + dx)) & 1);
+                    const bool alive = (block >> (y * 4 + x)) & 1;
+                    if (count == 3 || (alive && count == 2))
+                        result |= uint8_t(1 << ((y - 1) * 2 + x - 1));
+                }
+            }
+            t[block] = result;
+        }
+        return t;
+    }();
+    return table;
+}
+
+std::size_t _Hash(uint32_t nw, uint32_t ne, uint32_t sw, uint32_t se) {
+    uint64_t h = nw;
+    h = h * 0x9E3779B97F4A7C15ull + ne;
+    h = h * 0x9E3779B97F4A7C15ull + sw;
+    h = h * 0x9E3779B97F4A7C15ull + se;
+    return std::size_t((h ^ (h >> 32)) * 0xD6E8FEB86659FD93ull >> 16);
+}
+} // namespace
+
+constexpr const uint32_t HashLife::NONE;
+constexpr const uint32_t HashLife::DEAD;
+constexpr const uint32_t HashLife::ALIVE;
+
+HashLife::HashLife() : m_Table(MIN_TABLE_SIZE, NONE) {
+    this->m_Nodes.push_back({NONE, NONE, NONE, NONE, NONE, FREE_LEVEL, false, 0}); // index 0 is never used
+    this->m_Nodes.push_back({NONE, NONE, NONE, NONE, NONE, 0, false, 0});          // DEAD
+    this->m_Nodes.push_back({NONE, NONE, NONE, NONE, NONE, 0, false, 1});          // ALIVE
+    this->m_Empty.push_back(DEAD);
+    this->m_Root = this->_empty(3);
+}
+
+HashLife HashLife::FromDATFile(const std::string& filePath) {
+    HashLife life;
+    life.load(readDATFile(filePath));
+    return life;
+}
+
+void HashLife::load(const std::vector<glm::vec3>& points, int64_t offsetX, int64_t offsetY) {
+    for (const glm::vec3& point : points)
+        this->set(int64_t(point.x) + offsetX, int64_t(point.y) + offsetY, point.z != 0.f);
+}
+
+bool HashLife::get(int64_t x, int64_t y) const {
+    int level = this->m_Nodes[this->m_Root].level;
+    const int64_t half = int64_t(1) << (level - 1);
+    if (x < -half || y < -half || x >= half || y >= half)
+        return false;
+
+    // cell coordinates relative to the top left corner of the node
+    x += half;
+    y += half;
+    uint32_t node = this->m_Root;
+    while (level > 0 && this->m_Nodes[node].population) {
+        --level;
+        const _Node& n = this->m_Nodes[node];
+        const bool east = (x >> level) & 1, south = (y >> level) & 1;
+        node = south ? (east ? n.se : n.sw) : (east ? n.ne : n.nw);
+    }
+    return node == ALIVE;
+}
+
+void HashLife::set(int64_t x, int64_t y, bool alive) {
+    for (;;) {
+        const int level = this->m_Nodes[this->m_Root].level;
+        const int64_t half = int64_t(1) << (level - 1);
+        if (x >= -half && y >= -half && x < half && y < half) {
+            this->m_Root = this->_set(this->m_Root, x + half, y + half, alive);
+            return;
+        }
+        this->_expand();
+    }
+}
+
+void HashLife::clear() {
+    this->m_Root = this->_empty(3);
+    this->m_Generation = 0;
+    this->collectGarbage(false);
+}
+
+void HashLife::run(uint64_t generations) {
+    // powers of two from the largest, runs of equal step sizes keep their memoized results
+    for (int step = 63; step >= 0; --step) {
+        if (!((generations >> step) & 1))
+            continue;
+        this->_setStep(step);
+
+        // the pattern has to stay within the result (the center half of the root)
+        while (this->m_Nodes[this->m_Root].level < step + 2 || !this->_fitsCenter())
+            this->_expand();
+        this->_expand();
+        this->m_Root = this->_successor(this->m_Root);
+        this->m_Generation += uint64_t(1) << step;
+
+        if (this->m_NumNodes * sizeof(_Node) > this->m_MemoryLimit) {
+            this->collectGarbage(true);
+            if (this->m_NumNodes * sizeof(_Node) > this->m_MemoryLimit / 2)
+                this->collectGarbage(false);
+        }
+    }
+}
+
+uint64_t HashLife::getGeneration() const { return this->m_Generation; }
+uint64_t HashLife::getPopulation() const { return this->m_Nodes[this->m_Root].population; }
+
+bool HashLife::getBounds(int64_t& minX, int64_t& minY, int64_t& maxX, int64_t& maxY) const {
+    if (!this->getPopulation())
+        return false;
+
+    // first living cell along one axis (0 -> x, 1 -> y) from one side (0 -> minimum, 1 -> maximum), memoized per node
+    std::unordered_map<uint32_t, int64_t> memo;
+    std::function<int64_t(uint32_t, int, int)> edge = [&](uint32_t node, int axis, int side) -> int64_t {
+        const _Node& n = this->m_Nodes[node];
+        if (!n.level)
+            return 0;
+        auto it = memo.find(node);
+        if (it != memo.end())
+            return it->second;
+
+        // children of the low half (west or north) and of the high half (east or south)
+        const uint32_t low[2] = {n.nw, axis ? n.ne : n.sw};
+        const uint32_t high[2] = {axis ? n.sw : n.ne, n.se};
+        const int64_t half = int64_t(1) << (n.level - 1);
+        const uint32_t* first = side ? high : low;
+        const uint32_t* second = side ? low : high;
+        const int64_t firstOffset = side ? half : 0, secondOffset = side ? 0 : half;
+        int64_t result = 0;
+        const uint32_t* children = this->m_Nodes[first[0]].population || this->m_Nodes[first[1]].population ? first : second;
+        const int64_t offset = children == first ? firstOffset : secondOffset;
+        bool found = false;
+        for (int i = 0; i < 2; ++i) {
+            if (!this->m_Nodes[children[i]].population)
+                continue;
+            const int64_t value = edge(children[i], axis, side);
+            result = !found ? value : (side ? std::max(result, value) : std::min(result, value));
+            found = true;
+        }
+        result += offset;
+        memo[node] = result;
+        return result;
+    };
+
+    const int64_t half = int64_t(1) << (this->m_Nodes[this->m_Root].level - 1);
+    minX = edge(this->m_Root, 0, 0) - half;
+    memo.clear();
+    maxX = edge(this->m_Root, 0, 1) - half;
+    memo.clear();
+    minY = edge(this->m_Root, 1, 0) - half;
+    memo.clear();
+    maxY = edge(this->m_Root, 1, 1) - half;
+    return true;
+}
+
+void HashLife::setMemoryLimit(std::size_t bytes) { this->m_MemoryLimit = bytes; }
+
+void HashLife::collectGarbage(bool keepResults) {
+    this->_mark(this->m_Root, keepResults);
+    for (uint32_t node : this->m_Empty)
+        this->_mark(node, keepResults);
+
+    // sweep, the hash table is rebuilt from the remaining nodes
+    std::fill(this->m_Table.begin(), this->m_Table.end(), NONE);
+    this->m_NumNodes = 0;
+    for (uint32_t node = ALIVE + 1; node < uint32_t(this->m_Nodes.size()); ++node) {
+        _Node& n = this->m_Nodes[node];
+        if (n.level == FREE_LEVEL)
+            continue;
+        if (!n.marked) {
+            n.level = FREE_LEVEL;
+            this->m_Free.push_back(node);
+            continue;
+        }
+        n.marked = false;
+        this->_insert(node);
+    }
+}
+
+std::size_t HashLife::getNumNodes() const { return this->m_NumNodes; }
+
+std::size_t HashLife::getMemoryUsage() const {
+    return this->m_Nodes.capacity() * sizeof(_Node) + this->m_Table.size() * sizeof(uint32_t) +
+           this->m_Free.capacity() * sizeof(uint32_t);
+}
+
+void HashLife::render(cv::Mat& image, int64_t minX, int64_t minY, int64_t columns, int64_t rows, const Color& alive,
+                      const Color& dead) const {
+    if (columns <= 0 || rows <= 0)
+        throw std::runtime_error(R"(Error: empty region in function "HashLife::render")");
+    image.setTo(cv::Scalar(dead.b, dead.g, dead.r));
+    const int64_t half = int64_t(1) << (this->m_Nodes[this->m_Root].level - 1);
+    this->_render(image, this->m_Root, -half, -half, minX, minY, columns, rows, alive);
+}
+
+void HashLife::render(WindowRasterized& window, int64_t minX, int64_t minY, int64_t columns, int64_t rows,
+                      const Color& alive, const Color& dead) const {
+    this->render(window.getImage(), minX, minY, columns, rows, alive, dead);
+}
+
+void HashLife::render(WindowRasterized& window, const Color& alive, const Color& dead) const {
+    int64_t minX, minY, maxX, maxY;
+    if (!this->getBounds(minX, minY, maxX, maxY))
+        minX = minY = maxX = maxY = 0;
+    this->render(window, minX, minY, maxX - minX + 1, maxY - minY + 1, alive, dead);
+}
+
+uint32_t HashLife::_node(uint32_t nw, uint32_t ne, uint32_t sw, uint32_t se) {
+    const std::size_t mask = this->m_Table.size() - 1;
+    std::size_t slot = _Hash(nw, ne, sw, se) & mask;
+    for (; this->m_Table[slot] != NONE; slot = (slot + 1) & mask) {
+        const _Node& n = this->m_Nodes[this->m_Table[slot]];
+        if (n.nw == nw && n.ne == ne && n.sw == sw && n.se == se)
+            return this->m_Table[slot];
+    }
+
+    const _Node node = {nw,    ne, sw, se, NONE, uint8_t(this->m_Nodes[nw].level + 1),
+                        false, this->m_Nodes[nw].population + this->m_Nodes[ne].population +
+                                   this->m_Nodes[sw].population + this->m_Nodes[se].population};
+    uint32_t index;
+    if (!this->m_Free.empty()) {
+        index = this->m_Free.back();
+        this->m_Free.pop_back();
+        this->m_Nodes[index] = node;
+    } else {
+        if (this->m_Nodes.size() >= std::size_t(std::numeric_limits<uint32_t>::max()))
+            throw std::runtime_error(R"(Error: too many nodes in function "HashLife::_node")");
+        index = uint32_t(this->m_Nodes.size());
+        this->m_Nodes.push_back(node);
+    }
+
+    this->m_Table[slot] = index;
+    if (++this->m_NumNodes * 2 > this->m_Table.size())
+        this->_grow();
+    return index;
+}
+
+uint32_t HashLife::_empty(int level) {
+    while (int(this->m_Empty.size()) <= level) {
+        const uint32_t e = this->m_Empty.back();
+        this->m_Empty.push_back(this->_node(e, e, e, e));
+    }
+    return this->m_Empty[std::size_t(level)];
+}
+
+uint32_t HashLife::_set(uint32_t node, int64_t x, int64_t y, bool alive) {
+    const int level = this->m_Nodes[node].level;
+    if (!level)
+        return alive ? ALIVE : DEAD;
+
+    const int64_t half = int64_t(1) << (level - 1);
+    _Node n = this->m_Nodes[node];
+    if (y < half)
+        (x < half ? n.nw : n.ne) = this->_set(x < half ? n.nw : n.ne, x % half, y, alive);
+    else
+        (x < half ? n.sw : n.se) = this->_set(x < half ? n.sw : n.se, x % half, y - half, alive);
+    return this->_node(n.nw, n.ne, n.sw, n.se);
+}
+
+uint32_t HashLife::_center(uint32_t node) {
+    const _Node n = this->m_Nodes[node];
+    return this->_node(this->m_Nodes[n.nw].se, this->m_Nodes[n.ne].sw, this->m_Nodes[n.sw].ne, this->m_Nodes[n.se].nw);
+}
+
+uint32_t HashLife::_horizontal(uint32_t west, uint32_t east) {
+    const _Node w = this->m_Nodes[west], e = this->m_Nodes[east];
+    return this->_node(w.ne, e.nw, w.se, e.sw);
+}
+
+uint32_t HashLife::_vertical(uint32_t north, uint32_t south) {
+    const _Node n = this->m_Nodes[north], s = this->m_Nodes[south];
+    return this->_node(n.sw, n.se, s.nw, s.ne);
+}
+
+uint32_t HashLife::_successor(uint32_t node) {
+    const _Node n = this->m_Nodes[node];
+    if (n.result != NONE)
+        return n.result;
+    if (!n.population || n.level == 2) {
+        const uint32_t result = n.population ? this->_leafSuccessor(node) : this->_empty(n.level - 1);
+        this->m_Nodes[node].result = result;
+        return result;
+    }
+
+    // 9 overlapping nodes of level k - 1
+    const uint32_t n00 = n.nw, n01 = this->_horizontal(n.nw, n.ne), n02 = n.ne;
+    const uint32_t n10 = this->_vertical(n.nw, n.sw), n11 = this->_center(node), n12 = this->_vertical(n.ne, n.se);
+    const uint32_t n20 = n.sw, n21 = this->_horizontal(n.sw, n.se), n22 = n.se;
+
+    // full step: both halves advance 2^(k-3) generations, smaller steps: the first half only takes the centers
+    const bool full = this->m_Step >= n.level - 2;
+    auto half = [&](uint32_t child) { return full ? this->_successor(child) : this->_center(child); };
+    const uint32_t r00 = half(n00), r01 = half(n01), r02 = half(n02);
+    const uint32_t r10 = half(n10), r11 = half(n11), r12 = half(n12);
+    const uint32_t r20 = half(n20), r21 = half(n21), r22 = half(n22);
+
+    const uint32_t nw = this->_successor(this->_node(r00, r01, r10, r11));
+    const uint32_t ne = this->_successor(this->_node(r01, r02, r11, r12));
+    const uint32_t sw = this->_successor(this->_node(r10, r11, r20, r21));
+    const uint32_t se = this->_successor(this->_node(r11, r12, r21, r22));
+    const uint32_t result = this->_node(nw, ne, sw, se);
+    this->m_Nodes[node].result = result;
+    return result;
+}
+
+uint32_t HashLife::_leafSuccessor(uint32_t node) {
+    const _Node& n = this->m_Nodes[node];
+    uint32_t block = 0;
+    const uint32_t quadrants[4] = {n.nw, n.ne, n.sw, n.se};
+    for (int q = 0; q < 4; ++q) {
+        const _Node& c = this->m_Nodes[quadrants[q]];
+        const int x = (q & 1) * 2, y = (q >> 1) * 2;
+        block |= uint32_t(c.nw == ALIVE) << (y * 4 + x) | uint32_t(c.ne == ALIVE) << (y * 4 + x + 1) |
+                 uint32_t(c.sw == ALIVE) << ((y + 1) * 4 + x) | uint32_t(c.se == ALIVE) << ((y + 1) * 4 + x + 1);
+    }
+    const uint8_t result = _LeafTable()[block];
+    return this->_node(result & 1 ? ALIVE : DEAD, result & 2 ? ALIVE : DEAD, result & 4 ? ALIVE : DEAD,
+                       result & 8 ? ALIVE : DEAD);
+}
+
+void HashLife::_expand() {
+    const _Node root = this->m_Nodes[this->m_Root];
+    if (root.level >= MAX_LEVEL)
+        throw std::runtime_error(R"(Error: the pattern exceeds the universe in function "HashLife::_expand")");
+    const uint32_t e = this->_empty(root.level - 1);
+    const uint32_t nw = this->_node(e, e, e, root.nw), ne = this->_node(e, e, root.ne, e);
+    const uint32_t sw = this->_node(e, root.sw, e, e), se = this->_node(root.se, e, e, e);
+    this->m_Root = this->_node(nw, ne, sw, se);
+}
+
+bool HashLife::_fitsCenter() const {
+    const _Node& root = this->m_Nodes[this->m_Root];
+    const uint64_t center =
+        this->m_Nodes[this->m_Nodes[root.nw].se].population + this->m_Nodes[this->m_Nodes[root.ne].sw].population +
+        this->m_Nodes[this->m_Nodes[root.sw].ne].population + this->m_Nodes[this->m_Nodes[root.se].nw].population;
+    return center == root.population;
+}
+
+void HashLife::_setStep(int step) {
+    if (step == this->m_Step)
+        return;
+
+    // results of the levels k with k - 2 > step depend on the step size
+    const int level = std::min(step, this->m_Step) + 2;
+    for (_Node& n : this->m_Nodes) {
+        if (n.level != FREE_LEVEL && n.level > level)
+            n.result = NONE;
+    }
+    this->m_Step = step;
+}
+
+void HashLife::_insert(uint32_t node) {
+    const _Node& n = this->m_Nodes[node];
+    const std::size_t mask = this->m_Table.size() - 1;
+    std::size_t slot = _Hash(n.nw, n.ne, n.sw, n.se) & mask;
+    while (this->m_Table[slot] != NONE)
+        slot = (slot + 1) & mask;
+    this->m_Table[slot] = node;
+    ++this->m_NumNodes;
+}
+
+void HashLife::_grow() {
+    this->m_Table.assign(this->m_Table.size() * 2, NONE);
+    this->m_NumNodes = 0;
+    for (uint32_t node = ALIVE + 1; node < uint32_t(this->m_Nodes.size()); ++node) {
+        if (this->m_Nodes[node].level != FREE_LEVEL)
+            this->_insert(node);
+    }
+}
+
+void HashLife::_mark(uint32_t node, bool keepResults) {
+    _Node& n = this->m_Nodes[node];
+    if (node <= ALIVE || n.marked)
+        return;
+    n.marked = true;
+    if (!keepResults)
+        n.result = NONE;
+    const _Node children = n;
+    this->_mark(children.nw, keepResults);
+    this->_mark(children.ne, keepResults);
+    this->_mark(children.sw, keepResults);
+    this->_mark(children.se, keepResults);
+    if (children.result != NONE)
+        this->_mark(children.result, keepResults);
+}
+
+void HashLife::_render(cv::Mat& image, uint32_t node, int64_t x, int64_t y, int64_t minX, int64_t minY, int64_t columns,
+                       int64_t rows, const Color& alive) const {
+    const _Node& n = this->m_Nodes[node];
+    const int64_t size = int64_t(1) << n.level;
+    if (!n.population || x + size <= minX || y + size <= minY || x >= minX + columns || y >= minY + rows)
+        return;
+
+    // pixels covered by the node
+    const double scaleX = double(image.cols) / columns, scaleY = double(image.rows) / rows;
+    if (n.level && (size * scaleX > 1.0 || size * scaleY > 1.0)) {
+        const int64_t half = size / 2;
+        this->_render(image, n.nw, x, y, minX, minY, columns, rows, alive);
+        this->_render(image, n.ne, x + half, y, minX, minY, columns, rows, alive);
+        this->_render(image, n.sw, x, y + half, minX, minY, columns, rows, alive);
+        this->_render(image, n.se, x + half, y + half, minX, minY, columns, rows, alive);
+        return;
+    }
+    const int col0 = std::max(0, int(std::floor(double(x - minX) * scaleX)));
+    const int row0 = std::max(0, int(std::floor(double(y - minY) * scaleY)));
+    const int col1 = std::min(image.cols, std::max(col0 + 1, int(std::ceil(double(x + size - minX) * scaleX))));
+    const int row1 = std::min(image.rows, std::max(row0 + 1, int(std::ceil(double(y + size - minY) * scaleY))));
+    for (int row = row0; row < row1; ++row) {
+        cv::Vec3b* pixel = image.ptr<cv::Vec3b>(row);
+        for (int col = col0; col < col1; ++col) {
+            pixel[col][0] = alive.b;
+            pixel[col][1] = alive.g;
+            pixel[col][2] = alive.r;
+        }
+    }
+}
+} // namespace cf
@@ -0,0 +1,118 @@
+#include "inverseJulia.h"
+#include "internal.hpp"
+
+#include <atomic>
+#include <cmath>
+
+namespace cf {
+
+namespace {
+constexpr const int GUARD_SIZE = 512;      // guard grid cells per direction
+constexpr const std::size_t BRANCHES = 256; // independent branches distributed over the threads (power of two)
+
+/**
+ * @brief _HitGrid Shared atomic hit counts of a rectangular grid
+ */
+struct _HitGrid {
+    _HitGrid(int width, int height, double minX, double maxY, double scaleX, double scaleY)
+        : width(width), height(height), minX(minX), maxY(maxY), scaleX(scaleX), scaleY(scaleY),
+          hits(std::size_t(width) * std::size_t(height)) {
+        for (auto& h : this->hits)
+            h.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief find Hit count of the cell containing 'z', nullptr if outside of the grid
+     */
+    std::atomic<uint32_t>* find(const std::complex<double>& z) {
+        const double col = (z.real() - this->minX) * this->scaleX;
+        const double row = (this->maxY - z.imag()) * this->scaleY;
+        if (!(col >= 0.0 && row >= 0.0 && col < this->width && row < this->height))
+            return nullptr;
+        return &this->hits[std::size_t(row) * this->width + std::size_t(col)];
+    }
+
+    int width;
+    int height;
+    double minX;
+    double maxY;
+    double scaleX;
+    double scaleY;
+    std::vector<std::atomic<uint32_t>> hits;
+};
+} // namespace
+
+InverseJulia::InverseJulia(const std::complex<double>& c) : m_C(c) {}
+
+void InverseJulia::setMaxHits(uint32_t maxHits) {
+    if (!maxHits)
+        throw std::runtime_error(R"(Error: at least one hit per pixel is required in function "InverseJulia::setMaxHits")");
+    this->m_MaxHits = maxHits;
+}
+void InverseJulia::setNumThreads(unsigned numThreads) { this->m_NumThreads = numThreads; }
+
+std::size_t InverseJulia::calculate(DensityCanvas& canvas) const {
+    const Interval& range_x = canvas.getRangeX();
+    const Interval& range_y = canvas.getRangeY();
+    _HitGrid pixels(canvas.getWidth(), canvas.getHeight(), range_x.min, range_y.max,
+                    canvas.getWidth() / (double(range_x.max) - double(range_x.min)),
+                    canvas.getHeight() / (double(range_y.max) - double(range_y.min)));
+
+    // the Julia set lies within |z| <= 1/2 + sqrt(1/4 + |c|)
+    const double radius = 0.5 + std::sqrt(0.25 + std::abs(this->m_C)) + 1e-9;
+    _HitGrid guard(GUARD_SIZE, GUARD_SIZE, -radius, radius, 0.5 * GUARD_SIZE / radius, 0.5 * GUARD_SIZE / radius);
+
+    // repelling fixed point: z = 1/2 +- sqrt(1/4 - c) with |2z| >= 1
+    const std::complex<double> root = std::sqrt(0.25 - this->m_C);
+    const std::complex<double> start = std::abs(0.5 + root) >= std::abs(0.5 - root) ? 0.5 + root : 0.5 - root;
+
+    // branch 'b' follows the signs of the bits of 'b' for the first log2(BRANCHES) preimages
+    const unsigned numThreads = internal::_NumThreads(this->m_NumThreads, BRANCHES);
+    std::vector<std::size_t> visited(numThreads, 0);
+    const uint32_t maxHits = this->m_MaxHits;
+    const std::complex<double> c = this->m_C;
+
+    internal::_ParallelFor(BRANCHES, numThreads, [&](unsigned threadIdx, std::size_t branch) {
+        std::complex<double> z = start;
+        for (std::size_t bit = 1; bit < BRANCHES; bit <<= 1)
+            z = (branch & bit) ? -std::sqrt(z - c) : std::sqrt(z - c);
+
+        std::vector<std::complex<double>> stack(1, z);
+        std::size_t count = 0;
+        while (!stack.empty()) {
+            z = stack.back();
+            stack.pop_back();
+            ++count;
+
+            // visiting a saturated pixel/cell prunes the branch (as well as rounding errors beyond the guard grid)
+            std::atomic<uint32_t>* hits = pixels.find(z);
+            if (!hits)
+                hits = guard.find(z);
+            if (!hits || hits->fetch_add(1, std::memory_order_relaxed) >= maxHits)
+                continue;
+
+            const std::complex<double> w = std::sqrt(z - c);
+            stack.push_back(-w);
+            stack.push_back(w);
+        }
+        visited[threadIdx] += count;
+    });
+
+    for (int row = 0; row < canvas.getHeight(); ++row) {
+        uint32_t* data = canvas.getRow(row);
+        for (int col = 0; col < canvas.getWidth(); ++col)
+            data[col] += pixels.hits[std::size_t(row) * canvas.getWidth() + col].load(std::memory_order_relaxed);
+    }
+
+    std::size_t result = 0;
+    for (const auto& v : visited)
+        result += v;
+    return result;
+}
+
+void InverseJulia::render(WindowVectorized& window, const std::vector<Color>& palette) const {
+    DensityCanvas canvas(window);
+    this->calculate(canvas);
+    canvas.render(window, palette);
+}
+} // namespace cf
@@ -0,0 +1,294 @@
+#include "life.h"
+#include "internal.hpp"
+
+#include <random>
+
+namespace cf {
+
+namespace {
+constexpr const int TILE_ROWS = 32; // rows of a tile (a tile is one word wide), a row of tiles is one task
+
+uint64_t _PopCount(uint64_t word) {
+    word -= (word >> 1) & 0x5555555555555555ull;
+    word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (word * 0x0101010101010101ull) >> 56;
+}
+
+/**
+ * @brief _ColumnSums Sums of the cells x - 1, x and x + 1 of one row as two bit planes (0 ... 3), 'west'/'east' are the
+ * words left of the first and right of the last word
+ */
+inline void _ColumnSum(uint64_t l, uint64_t c, uint64_t r, uint64_t& sum0, uint64_t& sum1) {
+    // bit i of the word is the column 64 * k + i, the left neighbour is bit i - 1
+    const uint64_t w = (c << 1) | (l >> 63), e = (c >> 1) | (r << 63), x = w ^ c;
+    sum0 = x ^ e;
+    sum1 = (w & c) | (x & e);
+}
+
+void _ColumnSums(const uint64_t* row, int words, uint64_t west, uint64_t east, uint64_t* sum0, uint64_t* sum1) {
+    if (words == 1) {
+        _ColumnSum(west, row[0], east, sum0[0], sum1[0]);
+        return;
+    }
+    _ColumnSum(west, row[0], row[1], sum0[0], sum1[0]);
+    for (int k = 1; k < words - 1; ++k) // vectorized
+        _ColumnSum(row[k - 1], row[k], row[k + 1], sum0[k], sum1[k]);
+    _ColumnSum(row[words - 2], row[words - 1], east, sum0[words - 1], sum1[words - 1]);
+}
+
+/**
+ * @brief _Generation Next state of one row from the column sums of the rows above (a), the row itself (c) and below (b)
+ *
+ * the three sums are added (4 bit planes) to the count of all 9 cells: alive next generation if count == 3 or (alive and
+ * count == 4)
+ */
+void _Generation(const uint64_t* a0, const uint64_t* a1, const uint64_t* c0, const uint64_t* c1, const uint64_t* b0,
+                 const uint64_t* b1, const uint64_t* row, uint64_t* out, int words) {
+    for (int k = 0; k < words; ++k) { // vectorized
+        // a + c (0 ... 6)
+        const uint64_t s0 = a0[k] ^ c0[k], k0 = a0[k] & c0[k];
+        const uint64_t s1 = a1[k] ^ c1[k] ^ k0, s2 = (a1[k] & c1[k]) | (k0 & (a1[k] ^ c1[k]));
+
+        // a + c + b (0 ... 9)
+        const uint64_t t0 = s0 ^ b0[k], m0 = s0 & b0[k];
+        const uint64_t t1 = s1 ^ b1[k] ^ m0, m1 = (s1 & b1[k]) | (m0 & (s1 ^ b1[k]));
+        const uint64_t t2 = s2 ^ m1, t3 = s2 & m1;
+        out[k] = ~t3 & ((~t2 & t1 & t0) | (row[k] & t2 & ~t1 & ~t0));
+    }
+}
+
+/**
+ * @brief _Store Copies the words of 'row' to 'out' and accumulates the differences to the previous content in 'diff'
+ */
+void _Store(const uint64_t* row, uint64_t* out, uint64_t* diff, int words) {
+    for (int k = 0; k < words; ++k) { // vectorized
+        diff[k] |= out[k] ^ row[k];
+        out[k] = row[k];
+    }
+}
+} // namespace
+
+Life::Life(int width, int height, Topology topology)
+    : m_Width(width), m_Height(height), m_WordsPerRow((width + 63) / 64), m_Topology(topology) {
+    if (width <= 0 || height <= 0)
+        throw std::runtime_error(R"(Error: invalid grid size in function "Life::Life")");
+    if (topology == Topology::TORUS && width % 64)
+        throw std::runtime_error(R"(Error: the width of a torus has to be a multiple of 64 in function "Life::Life")");
+    this->m_LastWordMask = width % 64 ? (uint64_t(1) << (width % 64)) - 1 : ~uint64_t(0);
+    this->m_Words.assign(std::size_t(this->m_WordsPerRow) * height, 0);
+    this->m_Next.assign(this->m_Words.size(), 0);
+    this->m_Changed.assign(std::size_t((height + TILE_ROWS - 1) / TILE_ROWS) * this->m_WordsPerRow, 0);
+    this->m_NextChanged.assign(this->m_Changed.size(), 0);
+}
+
+Life Life::FromDATFile(const std::string& filePath, int width, int height, Topology topology) {
+    const std::vector<glm::vec3> points = readDATFile(filePath);
+    Life life(width, height, topology);
+    if (points.empty())
+        return life;
+
+    glm::vec3 minimum = points.front(), maximum = points.front();
+    for (const glm::vec3& point : points) {
+        minimum = glm::min(minimum, point);
+        maximum = glm::max(maximum, point);
+    }
+    life.load(points, (width - int(maximum.x - minimum.x) - 1) / 2 - int(minimum.x),
+              (height - int(maximum.y - minimum.y) - 1) / 2 - int(minimum.y));
+    return life;
+}
+
+void Life::load(const std::vector<glm::vec3>& points, int offsetX, int offsetY) {
+    for (const glm::vec3& point : points) {
+        const int x = int(point.x) + offsetX, y = int(point.y) + offsetY;
+        if (x < 0 || y < 0 || x >= this->m_Width || y >= this->m_Height)
+            throw std::runtime_error(R"(Error: cell outside of the grid in function "Life::load")");
+        this->set(x, y, point.z != 0.f);
+    }
+}
+
+void Life::randomize(double density, uint32_t seed) {
+    std::mt19937_64 generator(seed);
+    std::bernoulli_distribution alive(std::min(std::max(density, 0.0), 1.0));
+    for (int y = 0; y < this->m_Height; ++y) {
+        uint64_t* row = &this->m_Words[std::size_t(y) * this->m_WordsPerRow];
+        for (int k = 0; k < this->m_WordsPerRow; ++k) {
+            if (density == 0.5) {
+                row[k] = generator(); // one random bit per cell
+            } else {
+                row[k] = 0;
+                for (int bit = 0; bit < 64; ++bit)
+                    row[k] |= uint64_t(alive(generator)) << bit;
+            }
+        }
+        row[this->m_WordsPerRow - 1] &= this->m_LastWordMask;
+    }
+    this->m_FullGenerations = 2;
+}
+
+bool Life::get(int x, int y) const {
+    if (x < 0 || y < 0 || x >= this->m_Width || y >= this->m_Height)
+        return false;
+    return (this->m_Words[std::size_t(y) * this->m_WordsPerRow + x / 64] >> (x % 64)) & 1;
+}
+
+void Life::set(int x, int y, bool alive) {
+    if (x < 0 || y < 0 || x >= this->m_Width || y >= this->m_Height)
+        throw std::runtime_error(R"(Error: cell outside of the grid in function "Life::set")");
+    uint64_t& word = this->m_Words[std::size_t(y) * this->m_WordsPerRow + x / 64];
+    const uint64_t bit = uint64_t(1) << (x % 64);
+    word = alive ? word | bit : word & ~bit;
+    this->m_FullGenerations = 2;
+}
+
+void Life::clear() {
+    std::fill(this->m_Words.begin(), this->m_Words.end(), 0);
+    this->m_Generation = 0;
+    this->m_FullGenerations = 2;
+}
+
+void Life::step(uint64_t generations) {
+    const int words = this->m_WordsPerRow;
+    const int height = this->m_Height;
+    const bool torus = this->m_Topology == Topology::TORUS;
+    const int tileRows = (height + TILE_ROWS - 1) / TILE_ROWS;
+    const unsigned numThreads = internal::_NumThreads(this->m_NumThreads, std::size_t(tileRows));
+
+    // per thread: column sums of three consecutive rows (ring buffer), differences of the tiles, one row of the next
+    // generation and the active tiles of a row of tiles
+    std::vector<std::vector<uint64_t>> sums(numThreads, std::vector<uint64_t>(std::size_t(8) * words));
+    std::vector<std::vector<uint8_t>> active(numThreads, std::vector<uint8_t>(std::size_t(words)));
+
+    for (uint64_t generation = 0; generation < generations; ++generation) {
+        const uint64_t* cells = this->m_Words.data();
+        uint64_t* next = this->m_Next.data();
+        const uint8_t* changed = this->m_Changed.data();
+        uint8_t* nextChanged = this->m_NextChanged.data();
+        const bool all = this->m_FullGenerations > 0 || !this->m_ActiveTiles;
+        internal::_ParallelFor(std::size_t(tileRows), numThreads, [&](unsigned thread, std::size_t task) {
+            const int tileRow = int(task);
+            uint8_t* isActive = active[thread].data();
+            if (all) {
+                std::fill(isActive, isActive + words, uint8_t(1));
+            } else {
+                // changed tiles of the last generation and their neighbours
+                for (int k = 0; k < words; ++k) {
+                    isActive[k] = changed[std::size_t(tileRow) * words + k];
+                    if (tileRow > 0 || torus)
+                        isActive[k] |= changed[std::size_t((tileRow + tileRows - 1) % tileRows) * words + k];
+                    if (tileRow + 1 < tileRows || torus)
+                        isActive[k] |= changed[std::size_t((tileRow + 1) % tileRows) * words + k];
+                }
+                const uint8_t first = isActive[0], last = isActive[words - 1];
+                uint8_t previous = torus ? last : 0;
+                for (int k = 0; k < words; ++k) {
+                    const uint8_t current = isActive[k];
+                    isActive[k] |= previous | (k + 1 < words ? isActive[k + 1] : (torus ? first : 0));
+                    previous = current;
+                }
+            }
+
+            // the next buffer holds the last generation (double buffering): if the neighbourhood of a tile equals the
+            // one two generations ago, the next generation of the tile equals the last generation (still lifes and
+            // period 2 oscillators), the tile is skipped
+            uint64_t* sum = sums[thread].data();
+            uint64_t* diff = sum + std::size_t(6) * words;
+            uint64_t* fresh = diff + words;
+            std::fill(diff, diff + words, uint64_t(0));
+            auto sum0 = [&](int y) { return sum + std::size_t(((y % 3) + 3) % 3) * 2 * words; };
+            auto sum1 = [&](int y) { return sum0(y) + words; };
+            const int firstRow = tileRow * TILE_ROWS;
+            const int lastRow = std::min(height, firstRow + TILE_ROWS);
+            for (int k0 = 0; k0 < words;) {
+                if (!isActive[k0]) {
+                    ++k0;
+                    continue;
+                }
+                int k1 = k0 + 1;
+                while (k1 < words && isActive[k1])
+                    ++k1;
+
+                // run of active tiles k0 ... k1 - 1, every row is summed up once per run
+                auto columnSums = [&](int y) {
+                    if (!torus && (y < 0 || y >= height)) {
+                        std::fill(sum0(y) + k0, sum0(y) + k1, 0); // dead row
+                        std::fill(sum1(y) + k0, sum1(y) + k1, 0);
+                        return;
+                    }
+                    const uint64_t* row = cells + std::size_t((y + height) % height) * words;
+                    const uint64_t west = k0 > 0 ? row[k0 - 1] : (torus ? row[words - 1] : 0);
+                    const uint64_t east = k1 < words ? row[k1] : (torus ? row[0] : 0);
+                    _ColumnSums(row + k0, k1 - k0, west, east, sum0(y) + k0, sum1(y) + k0);
+                };
+                columnSums(firstRow - 1);
+                columnSums(firstRow);
+                for (int y = firstRow; y < lastRow; ++y) {
+                    columnSums(y + 1);
+                    const uint64_t* row = cells + std::size_t(y) * words;
+                    uint64_t* out = next + std::size_t(y) * words;
+                    _Generation(sum0(y - 1) + k0, sum1(y - 1) + k0, sum0(y) + k0, sum1(y) + k0, sum0(y + 1) + k0,
+                                sum1(y + 1) + k0, row + k0, fresh + k0, k1 - k0);
+                    if (k1 == words)
+                        fresh[words - 1] &= this->m_LastWordMask;
+                    _Store(fresh + k0, out + k0, diff + k0, k1 - k0);
+                }
+                k0 = k1;
+            }
+
+            // tiles, which differ from two generations ago
+            uint8_t* flags = nextChanged + std::size_t(tileRow) * words;
+            for (int k = 0; k < words; ++k)
+                flags[k] = uint8_t(diff[k] != 0);
+        });
+        this->m_Words.swap(this->m_Next);
+        this->m_Changed.swap(this->m_NextChanged);
+        this->m_FullGenerations = std::max(0, this->m_FullGenerations - 1);
+        ++this->m_Generation;
+    }
+}
+
+void Life::setNumThreads(unsigned numThreads) { this->m_NumThreads = numThreads; }
+
+void Life::setActiveTiles(bool enabled) {
+    this->m_ActiveTiles = enabled;
+    this->m_FullGenerations = 2;
+}
+
+std::size_t Life::getNumChangedTiles() const {
+    return std::size_t(std::count(this->m_Changed.begin(), this->m_Changed.end(), uint8_t(1)));
+}
+uint64_t Life::getGeneration() const { return this->m_Generation; }
+
+uint64_t Life::getPopulation() const {
+    uint64_t population = 0;
+    for (uint64_t word : this->m_Words)
+        population += _PopCount(word);
+    return population;
+}
+
+int Life::getWidth() const { return this->m_Width; }
+int Life::getHeight() const { return this->m_Height; }
+Life::Topology Life::getTopology() const { return this->m_Topology; }
+const std::vector<uint64_t>& Life::getWords() const { return this->m_Words; }
+int Life::getWordsPerRow() const { return this->m_WordsPerRow; }
+
+void Life::render(cv::Mat& image, const Color& alive, const Color& dead) const {
+    std::vector<int> cellX(image.cols);
+    for (int col = 0; col < image.cols; ++col)
+        cellX[col] = int(double(col) * this->m_Width / image.cols);
+    for (int row = 0; row < image.rows; ++row) {
+        const uint64_t* cells = &this->m_Words[std::size_t(double(row) * this->m_Height / image.rows) * this->m_WordsPerRow];
+        cv::Vec3b* pixel = image.ptr<cv::Vec3b>(row);
+        for (int col = 0; col < image.cols; ++col) {
+            const Color& c = (cells[cellX[col] / 64] >> (cellX[col] % 64)) & 1 ? alive : dead;
+            pixel[col][0] = c.b;
+            pixel[col][1] = c.g;
+            pixel[col][2] = c.r;
+        }
+    }
+}
+
+void Life::render(WindowRasterized& window, const Color& alive, const Color& dead) const {
+    this->render(window.getImage(), alive, dead);
+}
+} // namespace cf
@@ -0,0 +1,215 @@
+#include "lyapunovMap.h"
+#include "internal.hpp"
+
+namespace cf {
+
+namespace {
+constexpr const int LANES = LyapunovMap::LANES;
+constexpr const int TILE_SIZE = 64; // has to be a multiple of LANES
+constexpr const std::size_t RENORMALIZATION_INTERVAL = 16;
+} // namespace
+
+LyapunovMap::LyapunovMap(const Orbit& orbit, std::size_t factorIndexX, std::size_t factorIndexY)
+    : LyapunovMap(OrbitMap(orbit),
+                  orbit.getNumStartingPoints()
+                      ? glm::dvec2(orbit.getAllStartingPoints().front().x, orbit.getAllStartingPoints().front().y)
+                      : glm::dvec2(0.0),
+                  factorIndexX, factorIndexY) {}
+
+LyapunovMap::LyapunovMap(const OrbitMap& map, const glm::dvec2& startingPoint, std::size_t factorIndexX,
+                         std::size_t factorIndexY)
+    : m_Mode(Mode::ORBIT_SLICE), m_Map(map), m_StartingPoint(startingPoint), m_FactorIndexX(factorIndexX),
+      m_FactorIndexY(factorIndexY) {
+    if (factorIndexX >= OrbitMap::NUM_FACTORS || factorIndexY >= OrbitMap::NUM_FACTORS)
+        throw std::out_of_range(R"(out of bound exception, in function "LyapunovMap::LyapunovMap")");
+}
+
+LyapunovMap LyapunovMap::MarkusLyapunov(const std::string& sequence) {
+    LyapunovMap map;
+    map.m_Mode = Mode::MARKUS_LYAPUNOV;
+    for (const auto& c : sequence) {
+        if (c == 'A' || c == 'a')
+            map.m_Sequence.push_back(0);
+        else if (c == 'B' || c == 'b')
+            map.m_Sequence.push_back(1);
+        else
+            throw std::runtime_error("Error: invalid sequence symbol '" + std::string(1, c) +
+                                     R"(' in function "LyapunovMap::MarkusLyapunov", allowed symbols: 'A' and 'B')");
+    }
+    if (map.m_Sequence.empty())
+        throw std::runtime_error(R"(Error: empty sequence in function "LyapunovMap::MarkusLyapunov")");
+    return map;
+}
+
+void LyapunovMap::setIterations(std::size_t transient, std::size_t iterations) {
+    if (!iterations)
+        throw std::runtime_error(R"(Error: at least one iteration is required in function "LyapunovMap::setIterations")");
+    this->m_TransientIterations = transient;
+    this->m_Iterations = iterations;
+}
+void LyapunovMap::setNumThreads(unsigned numThreads) { this->m_NumThreads = numThreads; }
+
+std::vector<float> LyapunovMap::calculate(int width, int height, const Interval& range_x, const Interval& range_y) const {
+    if (width <= 0 || height <= 0)
+        throw std::runtime_error(R"(Error: invalid image size in function "LyapunovMap::calculate")");
+
+    std::vector<float> exponents(std::size_t(width) * std::size_t(height));
+    const double stepX = (double(range_x.max) - double(range_x.min)) / width;
+    const double stepY = (double(range_y.max) - double(range_y.min)) / height;
+
+    const int tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+    const int tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+    internal::_ParallelFor(std::size_t(tilesX) * tilesY, this->m_NumThreads, [&](unsigned, std::size_t tile) {
+        const int tileX = int(tile % tilesX) * TILE_SIZE;
+        const int tileY = int(tile / tilesX) * TILE_SIZE;
+        const int endX = std::min(width, tileX + TILE_SIZE);
+        const int endY = std::min(height, tileY + TILE_SIZE);
+
+        double paramX[LANES];
+        float result[LANES];
+        for (int row = tileY; row < endY; ++row) {
+            const double paramY = range_y.max - (row + 0.5) * stepY;
+            for (int col = tileX; col < endX; col += LANES) {
+                // the last lane group of a row may be incomplete, those lanes repeat the last column
+                for (int l = 0; l < LANES; ++l)
+                    paramX[l] = range_x.min + (std::min(col + l, width - 1) + 0.5) * stepX;
+
+                this->_calculateLanes(paramX, paramY, result);
+                const int numLanes = std::min(LANES, endX - col);
+                std::copy(result, result + numLanes, &exponents[std::size_t(row) * width + col]);
+            }
+        }
+    });
+    return exponents;
+}
+
+void LyapunovMap::render(WindowVectorized& window, const std::vector<Color>& palette) const {
+    if (palette.size() < 2)
+        throw std::runtime_error(R"(Error: palette requires at least two colors in function "LyapunovMap::render")");
+
+    cv::Mat& image = window.getImage();
+    const std::vector<float> exponents = this->calculate(image.cols, image.rows, window.getIntervalX(), window.getIntervalY());
+
+    float minExponent = 0.f;
+    for (const auto& e : exponents) {
+        if (std::isfinite(e))
+            minExponent = std::min(minExponent, e);
+    }
+    const float scale = minExponent < 0.f ? float(palette.size() - 2) / -minExponent : 0.f;
+
+    for (int row = 0; row < image.rows; ++row) {
+        const float* data = &exponents[std::size_t(row) * image.cols];
+        cv::Vec3b* pixel = image.ptr<cv::Vec3b>(row);
+        for (int col = 0; col < image.cols; ++col) {
+            const float e = data[col];
+            std::size_t idx = 0;
+            if (e < 0.f) // -inf -> super stable
+                idx = std::isfinite(e) ? 1 + std::size_t(-e * scale) : palette.size() - 1;
+
+            const Color& c = palette[std::min(idx, palette.size() - 1)];
+            pixel[col][0] = c.b;
+            pixel[col][1] = c.g;
+            pixel[col][2] = c.r;
+        }
+    }
+}
+
+void LyapunovMap::_calculateLanes(const double* paramX, double paramY, float* result) const {
+    const std::size_t transient = this->m_TransientIterations;
+    const std::size_t iterations = this->m_Iterations;
+    double sum[LANES];
+    std::fill(sum, sum + LANES, 0.0);
+
+    if (this->m_Mode == Mode::MARKUS_LYAPUNOV) {
+        const std::vector<uint8_t>& sequence = this->m_Sequence;
+        double x[LANES], derivative[LANES], rateB[LANES];
+        std::fill(x, x + LANES, 0.5);
+        std::fill(derivative, derivative + LANES, 1.0);
+        std::fill(rateB, rateB + LANES, paramY);
+
+        // the rate of the sequence symbol is selected once per iteration, the lane loops are branch free
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i < transient; ++i, pos = (pos + 1 == sequence.size() ? 0 : pos + 1)) {
+            const double* r = sequence[pos] ? rateB : paramX;
+            for (int l = 0; l < LANES; ++l) // vectorized
+                x[l] = r[l] * x[l] * (1.0 - x[l]);
+        }
+        for (std::size_t i = 0; i < iterations; ++i, pos = (pos + 1 == sequence.size() ? 0 : pos + 1)) {
+            const double* r = sequence[pos] ? rateB : paramX;
+            for (int l = 0; l < LANES; ++l) { // vectorized
+                derivative[l] *= std::abs(r[l] * (1.0 - 2.0 * x[l]));
+                x[l] = r[l] * x[l] * (1.0 - x[l]);
+            }
+            // the product of all derivatives is only converted every few iterations
+            if ((i + 1) % RENORMALIZATION_INTERVAL == 0 || i + 1 == iterations) {
+                for (int l = 0; l < LANES; ++l) {
+                    sum[l] += std::log(derivative[l]);
+                    derivative[l] = 1.0;
+                }
+            }
+        }
+    } else {
+        // structure of arrays: factors, point and tangent vector per lane, the lane loops inline
+        // OrbitMap::Evaluate/Jacobian with copysign instead of branches
+        double f[OrbitMap::NUM_FACTORS][LANES];
+        for (std::size_t k = 0; k < OrbitMap::NUM_FACTORS; ++k)
+            std::fill(f[k], f[k] + LANES, this->m_Map.factors[k]);
+        std::copy(paramX, paramX + LANES, f[this->m_FactorIndexX]);
+        std::fill(f[this->m_FactorIndexY], f[this->m_FactorIndexY] + LANES, paramY);
+
+        double px[LANES], py[LANES], tx[LANES], ty[LANES], rootFactor[LANES];
+        std::fill(px, px + LANES, this->m_StartingPoint.x);
+        std::fill(py, py + LANES, this->m_StartingPoint.y);
+        std::fill(tx, tx + LANES, 0.6);
+        std::fill(ty, ty + LANES, 0.8);
+        // 0.5 * f * g, the root term has no derivative if f = 0 (see OrbitMap::Jacobian)
+        for (int l = 0; l < LANES; ++l)
+            rootFactor[l] = 0.5 * f[5][l] * f[6][l];
+
+        for (std::size_t i = 0; i < transient; ++i) {
+            for (int l = 0; l < LANES; ++l) { // vectorized
+                const double x = px[l], y = py[l];
+                const double sign = std::copysign(1.0, x + 0.0); // sign(-0) = 1
+                px[l] = f[0][l] + f[1][l] * y + f[2][l] * std::abs(x) + f[3][l] * x * x + f[4][l] * x * y +
+                        f[5][l] * sign * std::sqrt(std::abs(f[6][l] * x - f[7][l]));
+                py[l] = f[8][l] + f[9][l] * x;
+            }
+        }
+        for (std::size_t i = 0; i < iterations; ++i) {
+            for (int l = 0; l < LANES; ++l) { // vectorized
+                const double x = px[l], y = py[l];
+                const double sign = std::copysign(1.0, x + 0.0);
+                const double root = f[6][l] * x - f[7][l];
+                const double sqrtRoot = std::sqrt(std::abs(root));
+                // rootFactor = 0 -> 0 instead of 0 / 0 for a vanishing root
+                const double rootDerivative =
+                    rootFactor[l] * sign * std::copysign(1.0, root + 0.0) / (sqrtRoot + double(rootFactor[l] == 0.0));
+
+                const double dxdx = f[2][l] * sign + 2.0 * f[3][l] * x + f[4][l] * y + rootDerivative;
+                const double dxdy = f[1][l] + f[4][l] * x;
+                const double newTx = dxdx * tx[l] + dxdy * ty[l];
+                ty[l] = f[9][l] * tx[l];
+                tx[l] = newTx;
+
+                px[l] = f[0][l] + f[1][l] * y + f[2][l] * std::abs(x) + f[3][l] * x * x + f[4][l] * x * y +
+                        f[5][l] * sign * sqrtRoot;
+                py[l] = f[8][l] + f[9][l] * x;
+            }
+            // the tangent vector grows/shrinks exponentially, renormalize every few iterations
+            if ((i + 1) % RENORMALIZATION_INTERVAL == 0 || i + 1 == iterations) {
+                for (int l = 0; l < LANES; ++l) {
+                    const double length = std::sqrt(tx[l] * tx[l] + ty[l] * ty[l]);
+                    sum[l] += std::log(length);
+                    // a vanishing tangent stays zero (the exponent is -inf)
+                    const double scale = 1.0 / std::max(length, std::numeric_limits<double>::min());
+                    tx[l] *= scale;
+                    ty[l] *= scale;
+                }
+            }
+        }
+    }
+
+    for (int l = 0; l < LANES; ++l)
+        result[l] = float(sum[l] / double(iterations));
+}
+} // namespace cf
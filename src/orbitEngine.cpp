@@ -0,0 +1,55 @@
+#include "orbitEngine.h"
+
+namespace cf {
+
+OrbitMap::OrbitMap(const cf::Orbit& orbit) : OrbitMap(orbit.getAllFactors()) {}
+
+OrbitMap::OrbitMap(const std::vector<float>& factorList) {
+    if (factorList.size() > OrbitMap::NUM_FACTORS)
+        throw std::runtime_error("Error: OrbitMap supports up to " + std::to_string(OrbitMap::NUM_FACTORS) +
+                                 " factors, provided: " + std::to_string(factorList.size()));
+
+    this->factors.fill(0.0);
+    for (std::size_t i = 0; i < factorList.size(); ++i)
+        this->factors[i] = double(factorList[i]);
+}
+
+OrbitEngine::OrbitEngine(const OrbitMap& map) : m_Map(map) {}
+OrbitEngine::OrbitEngine(const Orbit& orbit) : m_Map(orbit) {}
+
+void OrbitEngine::setCycleDetection(CycleHandling handling, double tolerance, std::size_t maxReplayPeriod) {
+    if (tolerance < 0.0)
+        throw std::runtime_error("Error: negative cycle tolerance in function \"OrbitEngine::setCycleDetection\"");
+
+    this->m_CycleHandling = handling;
+    this->m_CycleTolerance = tolerance;
+    this->m_MaxReplayPeriod = maxReplayPeriod;
+}
+OrbitEngine::CycleHandling OrbitEngine::getCycleHandling() const { return this->m_CycleHandling; }
+double OrbitEngine::getCycleTolerance() const { return this->m_CycleTolerance; }
+
+OrbitMap& OrbitEngine::getMap() { return this->m_Map; }
+const OrbitMap& OrbitEngine::getMap() const { return this->m_Map; }
+
+OrbitEngine::Result OrbitEngine::iterate(const glm::dvec2& start, std::size_t numIterations) const {
+    return this->iterate(start, numIterations, [](const glm::dvec2&, std::size_t) {});
+}
+
+void OrbitEngine::_calculateTransientLength(const glm::dvec2& start, Result& result) const {
+    // second phase of brent's algorithm:
+    // move 'hare' one period ahead, afterwards move both until they meet
+    glm::dvec2 tortoise = start;
+    glm::dvec2 hare = start;
+    for (std::size_t i = 0; i < result.period; ++i)
+        hare = this->m_Map(hare);
+    result.evaluations += result.period;
+
+    result.transientLength = 0;
+    while (!this->_equal(tortoise, hare) && result.transientLength < result.iterations) {
+        tortoise = this->m_Map(tortoise);
+        hare = this->m_Map(hare);
+        result.evaluations += 2;
+        ++result.transientLength;
+    }
+}
+} // namespace cf
@@ -0,0 +1,281 @@
+#include "orbitStream.h"
+#include "internal.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace cf {
+
+namespace {
+// file layout: header | chunk 0 | ... | chunk n-1 | chunk index | footer
+constexpr const char HEADER_MAGIC[4] = {'C', 'F', 'O', 'S'};
+constexpr const char FOOTER_MAGIC[4] = {'C', 'F', 'O', 'I'};
+constexpr const uint32_t VERSION = 1;
+constexpr const std::size_t HEADER_SIZE = 4 + 4 + 3 * 8;  // magic, version, resolution, origin x/y
+constexpr const std::size_t FOOTER_SIZE = 8 + 8 + 4 + 4;  // index offset, number of chunks, magic, padding
+
+void _WriteVarint(std::vector<uint8_t>& buffer, uint64_t v) {
+    while (v >= 0x80) {
+        buffer.push_back(uint8_t(v) | 0x80);
+        v >>= 7;
+    }
+    buffer.push_back(uint8_t(v));
+}
+
+// header, chunk index and footer are little endian on every platform (doubles as their IEEE 754 bit pattern)
+template <typename _Type> using _Bits = typename std::conditional<sizeof(_Type) == 4, uint32_t, uint64_t>::type;
+
+template <typename _Type> void _Write(std::ofstream& file, const _Type& value) {
+    static_assert(sizeof(_Type) == 4 || sizeof(_Type) == 8, "only 32 and 64 bit values are supported");
+    _Bits<_Type> bits;
+    std::memcpy(&bits, &value, sizeof(_Type));
+    char bytes[sizeof(_Type)];
+    for (std::size_t i = 0; i < sizeof(_Type); ++i)
+        bytes[i] = char(uint8_t(bits >> (8 * i)));
+    file.write(bytes, sizeof(_Type));
+}
+template <typename _Type> _Type _Read(const uint8_t* data) {
+    static_assert(sizeof(_Type) == 4 || sizeof(_Type) == 8, "only 32 and 64 bit values are supported");
+    _Bits<_Type> bits = 0;
+    for (std::size_t i = 0; i < sizeof(_Type); ++i)
+        bits |= _Bits<_Type>(data[i]) << (8 * i);
+    _Type value;
+    std::memcpy(&value, &bits, sizeof(_Type));
+    return value;
+}
+} // namespace
+
+OrbitRecorder::OrbitRecorder(const std::string& path, double resolution, const glm::dvec2& origin)
+    : m_File(path, std::ios::binary | std::ios::trunc), m_Resolution(resolution), m_Origin(origin) {
+    if (!this->m_File.is_open())
+        throw std::runtime_error("Error: unable to open file \"" + path + R"(" in function "OrbitRecorder::OrbitRecorder")");
+    if (!(resolution > 0.0))
+        throw std::runtime_error(R"(Error: resolution has to be positive in function "OrbitRecorder::OrbitRecorder")");
+
+    this->m_File.write(HEADER_MAGIC, 4);
+    _Write(this->m_File, VERSION);
+    _Write(this->m_File, resolution);
+    _Write(this->m_File, origin.x);
+    _Write(this->m_File, origin.y);
+    this->m_Buffer.reserve(CHUNK_RECORDS * 6);
+}
+
+OrbitRecorder::~OrbitRecorder() {
+    try {
+        this->close();
+    } catch (...) {
+    }
+}
+
+void OrbitRecorder::record(const glm::dvec2& point, std::size_t iteration) {
+    if (!this->m_File.is_open())
+        throw std::runtime_error(R"(Error: recorder has already been closed in function "OrbitRecorder::record")");
+    if (!std::isfinite(point.x) || !std::isfinite(point.y))
+        return;
+
+    const int64_t x = int64_t(std::llround((point.x - this->m_Origin.x) / this->m_Resolution));
+    const int64_t y = int64_t(std::llround((point.y - this->m_Origin.y) / this->m_Resolution));
+    if (!this->m_Current.numRecords)
+        this->m_Current.firstIteration = iteration;
+
+    _WriteVarint(this->m_Buffer, internal::_ZigZag(x - this->m_LastX));
+    _WriteVarint(this->m_Buffer, internal::_ZigZag(y - this->m_LastY));
+    _WriteVarint(this->m_Buffer, internal::_ZigZag(int64_t(iteration - this->m_LastIteration)));
+    this->m_LastX = x;
+    this->m_LastY = y;
+    this->m_LastIteration = iteration;
+    this->m_Current.firstIteration = std::min<uint64_t>(this->m_Current.firstIteration, iteration);
+    this->m_Current.lastIteration = std::max<uint64_t>(this->m_Current.lastIteration, iteration);
+    ++this->m_NumRecords;
+
+    if (++this->m_Current.numRecords == CHUNK_RECORDS)
+        this->_flushChunk();
+}
+
+void OrbitRecorder::close() {
+    if (!this->m_File.is_open())
+        return;
+
+    this->_flushChunk();
+    const uint64_t indexOffset = uint64_t(this->m_File.tellp());
+    for (const auto& chunk : this->m_Chunks) {
+        _Write(this->m_File, chunk.offset);
+        _Write(this->m_File, chunk.numRecords);
+        _Write(this->m_File, chunk.firstIteration);
+        _Write(this->m_File, chunk.lastIteration);
+    }
+    _Write(this->m_File, indexOffset);
+    _Write(this->m_File, uint64_t(this->m_Chunks.size()));
+    this->m_File.write(FOOTER_MAGIC, 4);
+    _Write(this->m_File, uint32_t(0));
+
+    const bool good = this->m_File.good();
+    this->m_File.close();
+    if (!good)
+        throw std::runtime_error(R"(Error: unable to write orbit stream in function "OrbitRecorder::close")");
+}
+
+std::size_t OrbitRecorder::getNumRecords() const { return this->m_NumRecords; }
+
+void OrbitRecorder::_flushChunk() {
+    if (!this->m_Current.numRecords)
+        return;
+
+    this->m_Current.offset = uint64_t(this->m_File.tellp());
+    this->m_File.write(reinterpret_cast<const char*>(this->m_Buffer.data()), std::streamsize(this->m_Buffer.size()));
+    this->m_Chunks.push_back(this->m_Current);
+
+    // the next chunk can be decoded on its own
+    this->m_Buffer.clear();
+    this->m_Current = {0, 0, 0, 0};
+    this->m_LastX = this->m_LastY = 0;
+    this->m_LastIteration = 0;
+}
+
+OrbitStream::OrbitStream(const std::string& path) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("Error: unable to open file \"" + path + R"(" in function "OrbitStream::OrbitStream")");
+    LARGE_INTEGER size;
+    GetFileSizeEx(file, &size);
+    this->m_Size = std::size_t(size.QuadPart);
+    HANDLE mapping = this->m_Size ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+    CloseHandle(file);
+    if (mapping) {
+        this->m_Data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!this->m_Data)
+            CloseHandle(mapping);
+        else
+            this->m_Handle = mapping;
+    }
+#else
+    const int file = open(path.c_str(), O_RDONLY);
+    if (file < 0)
+        throw std::runtime_error("Error: unable to open file \"" + path + R"(" in function "OrbitStream::OrbitStream")");
+    struct stat info;
+    if (fstat(file, &info) == 0)
+        this->m_Size = std::size_t(info.st_size);
+    if (this->m_Size) {
+        void* data = mmap(nullptr, this->m_Size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (data != MAP_FAILED) {
+            this->m_Data = static_cast<const uint8_t*>(data);
+            madvise(data, this->m_Size, MADV_SEQUENTIAL);
+        }
+    }
+    ::close(file);
+#endif
+    if (!this->m_Data)
+        throw std::runtime_error("Error: unable to map file \"" + path + R"(" in function "OrbitStream::OrbitStream")");
+
+    // validate the header, footer and chunk index
+    try {
+        if (this->m_Size < HEADER_SIZE + FOOTER_SIZE || std::memcmp(this->m_Data, HEADER_MAGIC, 4) != 0 ||
+            std::memcmp(this->m_Data + this->m_Size - 8, FOOTER_MAGIC, 4) != 0)
+            throw std::runtime_error("Error: \"" + path + R"(" is no orbit stream in function "OrbitStream::OrbitStream")");
+        if (_Read<uint32_t>(this->m_Data + 4) != VERSION)
+            throw std::runtime_error("Error: unsupported orbit stream version in file \"" + path +
+                                     R"(" in function "OrbitStream::OrbitStream")");
+
+        this->m_Resolution = _Read<double>(this->m_Data + 8);
+        this->m_Origin = glm::dvec2(_Read<double>(this->m_Data + 16), _Read<double>(this->m_Data + 24));
+
+        const uint8_t* footer = this->m_Data + this->m_Size - FOOTER_SIZE;
+        const uint64_t indexOffset = _Read<uint64_t>(footer);
+        const uint64_t numChunks = _Read<uint64_t>(footer + 8);
+        // divisions instead of products: the values are read from the file and must not wrap around
+        const uint64_t indexEnd = this->m_Size - FOOTER_SIZE;
+        if (indexOffset < HEADER_SIZE || indexOffset > indexEnd ||
+            (indexEnd - indexOffset) % sizeof(internal::_OrbitChunkInfo) != 0 ||
+            numChunks != (indexEnd - indexOffset) / sizeof(internal::_OrbitChunkInfo))
+            throw std::runtime_error("Error: corrupt chunk index in file \"" + path + R"(" in function "OrbitStream::OrbitStream")");
+
+        this->m_IndexOffset = indexOffset;
+        this->m_Chunks.resize(std::size_t(numChunks));
+        for (std::size_t i = 0; i < this->m_Chunks.size(); ++i) {
+            const uint8_t* entry = this->m_Data + indexOffset + i * sizeof(internal::_OrbitChunkInfo);
+            this->m_Chunks[i] = {_Read<uint64_t>(entry), _Read<uint64_t>(entry + 8), _Read<uint64_t>(entry + 16),
+                                 _Read<uint64_t>(entry + 24)};
+        }
+        for (std::size_t i = 0; i < this->m_Chunks.size(); ++i) {
+            const auto& chunk = this->m_Chunks[i];
+            const uint64_t end = i + 1 < this->m_Chunks.size() ? this->m_Chunks[i + 1].offset : indexOffset;
+            // every record needs at least 3 bytes, a chunk must not exceed its successor
+            if (chunk.offset < HEADER_SIZE || chunk.offset > end || chunk.numRecords > (end - chunk.offset) / 3)
+                throw std::runtime_error("Error: corrupt chunk index in file \"" + path + R"(" in function "OrbitStream::OrbitStream")");
+            this->m_NumRecords += std::size_t(chunk.numRecords);
+        }
+    } catch (...) {
+        this->_unmap();
+        throw;
+    }
+}
+
+OrbitStream::~OrbitStream() { this->_unmap(); }
+
+void OrbitStream::_unmap() {
+    if (!this->m_Data)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(this->m_Data);
+    CloseHandle(static_cast<HANDLE>(this->m_Handle));
+#else
+    munmap(const_cast<uint8_t*>(this->m_Data), this->m_Size);
+#endif
+    this->m_Data = nullptr;
+}
+
+std::size_t OrbitStream::getNumRecords() const { return this->m_NumRecords; }
+std::size_t OrbitStream::getNumChunks() const { return this->m_Chunks.size(); }
+double OrbitStream::getResolution() const { return this->m_Resolution; }
+void OrbitStream::setNumThreads(unsigned numThreads) { this->m_NumThreads = numThreads; }
+
+void OrbitStream::replay(DensityCanvas& canvas, uint64_t firstIteration, uint64_t lastIteration) const {
+    // only chunks overlapping the iteration range have to be decoded
+    std::vector<std::size_t> chunks;
+    for (std::size_t i = 0; i < this->m_Chunks.size(); ++i) {
+        if (this->m_Chunks[i].lastIteration >= firstIteration && this->m_Chunks[i].firstIteration <= lastIteration)
+            chunks.push_back(i);
+    }
+
+    const unsigned numThreads = internal::_NumThreads(this->m_NumThreads, chunks.size());
+    if (numThreads == 1) {
+        for (const auto& chunk : chunks) {
+            this->_decodeChunk(chunk, [&](const Record& r) {
+                if (r.iteration >= firstIteration && r.iteration <= lastIteration)
+                    canvas.addPoint(r.point.x, r.point.y);
+            });
+        }
+        return;
+    }
+
+    // every thread (except the calling one) gets its own canvas, which will be merged afterwards
+    std::vector<DensityCanvas> canvases(numThreads - 1, DensityCanvas(canvas.getWidth(), canvas.getHeight(),
+                                                                      canvas.getRangeX(), canvas.getRangeY()));
+    internal::_ParallelFor(chunks.size(), numThreads, [&](unsigned threadIdx, std::size_t idx) {
+        DensityCanvas& target = threadIdx ? canvases[threadIdx - 1] : canvas;
+        this->_decodeChunk(chunks[idx], [&](const Record& r) {
+            if (r.iteration >= firstIteration && r.iteration <= lastIteration)
+                target.addPoint(r.point.x, r.point.y);
+        });
+    });
+    for (const auto& c : canvases) {
+        for (int row = 0; row < canvas.getHeight(); ++row) {
+            uint32_t* dst = canvas.getRow(row);
+            const uint32_t* src = c.getRow(row);
+            for (int col = 0; col < canvas.getWidth(); ++col)
+                dst[col] += src[col];
+        }
+    }
+}
+} // namespace cf
@@ -0,0 +1,187 @@
+#include "progressiveRenderer.h"
+
+#include <cmath>
+
+namespace cf {
+
+namespace {
+constexpr const double REUSE_TOLERANCE = 1e-3; // maximum distance (in pixels) of a reused pixel center
+constexpr const int MAX_STEP = 1024;
+
+// states of m_Known
+constexpr const uint8_t UNKNOWN = 0;
+constexpr const uint8_t ITERATED = 1;
+constexpr const uint8_t SEEDED = 2; // nearest sample of the previous view, iterated again by its pass
+
+/**
+ * @brief The _Position struct Nearest pixel of the previous view, 'exact' -> the pixel centers coincide
+ */
+struct _Position {
+    int index;
+    bool exact;
+};
+
+/**
+ * @brief _MapPositions Maps the pixel centers 'offset + (idx + 0.5) * scale' (in pixels of the previous view) onto the
+ * nearest pixel of the previous view within half a new pixel, index -1 if there is none
+ */
+std::vector<_Position> _MapPositions(int count, double offset, double scale, int previousCount) {
+    std::vector<_Position> positions(count, _Position{-1, false});
+    for (int idx = 0; idx < count; ++idx) {
+        const double position = offset + (idx + 0.5) * scale - 0.5;
+        const double rounded = std::round(position);
+        const double distance = std::abs(position - rounded);
+        if (rounded >= 0.0 && rounded < previousCount && distance < (0.5 + REUSE_TOLERANCE) * scale)
+            positions[idx] = _Position{int(rounded), distance < REUSE_TOLERANCE};
+    }
+    return positions;
+}
+} // namespace
+
+ProgressiveRenderer::ProgressiveRenderer(const EscapeTime& fractal, const std::vector<Color>& palette, const Color& insideColor)
+    : m_Fractal(fractal), m_Palette(palette), m_InsideColor(insideColor) {
+    if (palette.empty())
+        throw std::runtime_error(R"(Error: empty palette in function "ProgressiveRenderer::ProgressiveRenderer")");
+}
+
+void ProgressiveRenderer::setFractal(const EscapeTime& fractal) {
+    this->m_Fractal = fractal;
+    this->clear();
+}
+
+void ProgressiveRenderer::setCoarsestStep(int step) {
+    if (step < 1 || step > MAX_STEP || (step & (step - 1)))
+        throw std::runtime_error(R"(Error: step has to be a power of two within [1, 1024] in function "ProgressiveRenderer::setCoarsestStep")");
+    this->m_CoarsestStep = step;
+}
+
+void ProgressiveRenderer::clear() {
+    this->m_Result = EscapeTime::Result();
+    this->m_Known.clear();
+}
+
+const EscapeTime::Result& ProgressiveRenderer::calculate(int width, int height, const Interval& range_x,
+                                                         const Interval& range_y, const Callback& onPass) {
+    if (width <= 0 || height <= 0)
+        throw std::runtime_error(R"(Error: invalid image size in function "ProgressiveRenderer::calculate")");
+
+    // same pixel centers as EscapeTime::calculate
+    const double minX = range_x.min;
+    const double maxY = range_y.max;
+    const double stepX = (double(range_x.max) - double(range_x.min)) / width;
+    const double stepY = (double(range_y.max) - double(range_y.min)) / height;
+    this->_reuse(width, height, minX, maxY, stepX, stepY);
+
+    EscapeTime::Result& result = this->m_Result;
+    std::vector<std::size_t> indices;
+    std::vector<std::complex<double>> points;
+    for (int step = this->m_CoarsestStep; step >= 1; step /= 2) {
+        // samples of this pass: pixels at multiples of 'step', which are not known yet
+        indices.clear();
+        points.clear();
+        for (int row = 0; row < height; row += step) {
+            for (int col = 0; col < width; col += step) {
+                const std::size_t idx = std::size_t(row) * width + col;
+                if (this->m_Known[idx] != ITERATED) {
+                    indices.push_back(idx);
+                    points.emplace_back(minX + (col + 0.5) * stepX, maxY - (row + 0.5) * stepY);
+                }
+            }
+        }
+
+        const EscapeTime::Result samples = this->m_Fractal.calculate(points);
+        for (std::size_t i = 0; i < indices.size(); ++i) {
+            result.iterations[indices[i]] = samples.iterations[i];
+            result.norms[indices[i]] = samples.norms[i];
+            this->m_Known[indices[i]] = ITERATED;
+        }
+        result.evaluations += samples.evaluations;
+        result.computedPixels += samples.computedPixels;
+
+        // preview: unknown pixels show the sample of their block, seeded pixels keep the sample of the previous view
+        if (step > 1) {
+            for (int row = 0; row < height; ++row) {
+                const std::size_t offset = std::size_t(row) * width;
+                const std::size_t blockOffset = std::size_t(row - row % step) * width;
+                for (int col = 0; col < width; ++col) {
+                    if (this->m_Known[offset + col] == UNKNOWN) {
+                        result.iterations[offset + col] = result.iterations[blockOffset + col - col % step];
+                        result.norms[offset + col] = result.norms[blockOffset + col - col % step];
+                    }
+                }
+            }
+        }
+
+        if (onPass)
+            onPass(step, result);
+    }
+    return result;
+}
+
+void ProgressiveRenderer::render(WindowVectorized& window, const std::function<void(int step)>& onPass) {
+    const cv::Mat& image = window.getImage();
+    this->calculate(image.cols, image.rows, window.getIntervalX(), window.getIntervalY(),
+                    [&](int step, const EscapeTime::Result& result) {
+                        EscapeTime::render(result, window, this->m_Palette, this->m_InsideColor);
+                        if (onPass)
+                            onPass(step);
+                    });
+}
+
+std::size_t ProgressiveRenderer::getReusedPixels() const { return this->m_ReusedPixels; }
+std::size_t ProgressiveRenderer::getSeededPixels() const { return this->m_SeededPixels; }
+
+void ProgressiveRenderer::_reuse(int width, int height, double minX, double maxY, double stepX, double stepY) {
+    EscapeTime::Result previous;
+    std::vector<uint8_t> previousKnown;
+    std::swap(previous, this->m_Result);
+    std::swap(previousKnown, this->m_Known);
+
+    EscapeTime::Result& result = this->m_Result;
+    result.width = width;
+    result.height = height;
+    result.maxIterations = this->m_Fractal.getMaxIterations();
+    result.escapeRadius = this->m_Fractal.getEscapeRadius();
+    result.iterations.assign(std::size_t(width) * std::size_t(height), 0);
+    result.norms.assign(result.iterations.size(), 0.0);
+    this->m_Known.assign(result.iterations.size(), UNKNOWN);
+    this->m_ReusedPixels = 0;
+    this->m_SeededPixels = 0;
+
+    if (!previous.iterations.empty()) {
+        const std::vector<_Position> columns =
+            _MapPositions(width, (minX - this->m_MinX) / this->m_StepX, stepX / this->m_StepX, previous.width);
+        const std::vector<_Position> rows =
+            _MapPositions(height, (this->m_MaxY - maxY) / this->m_StepY, stepY / this->m_StepY, previous.height);
+
+        // coinciding pixel centers are reused, all other pixels are seeded with the nearest sample for the preview
+        for (int row = 0; row < height; ++row) {
+            if (rows[row].index < 0)
+                continue;
+            const std::size_t offset = std::size_t(row) * width;
+            const std::size_t previousOffset = std::size_t(rows[row].index) * previous.width;
+            for (int col = 0; col < width; ++col) {
+                if (columns[col].index < 0)
+                    continue;
+                const std::size_t previousIdx = previousOffset + columns[col].index;
+                if (previousKnown[previousIdx] != ITERATED)
+                    continue;
+                result.iterations[offset + col] = previous.iterations[previousIdx];
+                result.norms[offset + col] = previous.norms[previousIdx];
+                if (rows[row].exact && columns[col].exact) {
+                    this->m_Known[offset + col] = ITERATED;
+                    ++this->m_ReusedPixels;
+                } else {
+                    this->m_Known[offset + col] = SEEDED;
+                    ++this->m_SeededPixels;
+                }
+            }
+        }
+    }
+
+    this->m_MinX = minX;
+    this->m_MaxY = maxY;
+    this->m_StepX = stepX;
+    this->m_StepY = stepY;
+}
+} // namespace cf
@@ -0,0 +1,588 @@
+#include "turmite.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace cf {
+
+namespace {
+constexpr const int DX[4] = {0, 1, 0, -1}; // NORTH, EAST, SOUTH, WEST (row 0 is the top most row)
+constexpr const int DY[4] = {-1, 0, 1, 0};
+constexpr const uint64_t RECORDED_STEPS = 1 << 16;          // steps of a recorded run (highway detection)
+constexpr const uint64_t MAX_UNRECORDED_STEPS = 1ull << 28; // upper bound of the steps between two recorded runs
+
+int64_t _FloorDiv(int64_t a, int64_t b) {
+    const int64_t q = a / b;
+    return (a % b != 0 && ((a < 0) != (b < 0))) ? q - 1 : q;
+}
+int64_t _CeilDiv(int64_t a, int64_t b) { return -_FloorDiv(-a, b); }
+
+/**
+ * @brief _AxisPeriods Range of all k with a + k * d within [min - r, max + r] (one axis)
+ * @return False, if there is no such k
+ */
+bool _AxisPeriods(int64_t min, int64_t max, int64_t a, int64_t d, int64_t r, int64_t& first, int64_t& last) {
+    if (!d) {
+        first = std::numeric_limits<int64_t>::min();
+        last = std::numeric_limits<int64_t>::max();
+        return a >= min - r && a <= max + r;
+    }
+    first = d > 0 ? _CeilDiv(min - r - a, d) : _CeilDiv(max + r - a, d);
+    last = d > 0 ? _FloorDiv(max + r - a, d) : _FloorDiv(min - r - a, d);
+    return first <= last;
+}
+
+/**
+ * @brief _Periods Range of all k, for which the square of radius 'r' around (ax, ay) + k * (dx, dy) intersects the
+ * rectangle [minX, maxX] x [minY, maxY]
+ */
+bool _Periods(int64_t minX, int64_t minY, int64_t maxX, int64_t maxY, int64_t ax, int64_t ay, int64_t dx, int64_t dy,
+              int64_t r, int64_t& first, int64_t& last) {
+    int64_t firstY, lastY;
+    if (!_AxisPeriods(minX, maxX, ax, dx, r, first, last) || !_AxisPeriods(minY, maxY, ay, dy, r, firstY, lastY))
+        return false;
+    first = std::max(first, firstY);
+    last = std::min(last, lastY);
+    return first <= last;
+}
+
+/**
+ * @brief _Steps Performs 'steps' steps without any bounds check, the ant must not leave the grid
+ *
+ * the three table lookups of a step are independent of each other (short dependency chain from cell to cell)
+ */
+void _Steps(uint8_t* cells, std::size_t& position, int& direction, uint64_t steps, const uint16_t* directionTable,
+            const std::ptrdiff_t* offsetTable, const uint8_t* nextState) {
+    std::size_t p = position;
+    unsigned d = unsigned(direction) * Turmite::MAX_STATES;
+    for (uint64_t i = 0; i < steps; ++i) {
+        const uint8_t state = cells[p];
+        const unsigned idx = d + state;
+        cells[p] = nextState[state];
+        d = directionTable[idx];
+        p += offsetTable[idx];
+    }
+    position = p;
+    direction = int(d / Turmite::MAX_STATES);
+}
+} // namespace
+
+Turmite::Turmite(const std::string& rule, int width, int height) : m_Rule(rule), m_Width(width), m_Height(height) {
+    if (width <= 0 || height <= 0)
+        throw std::runtime_error(R"(Error: invalid grid size in function "Turmite::Turmite")");
+    this->_createTables(width);
+    this->clear();
+}
+
+Turmite::Turmite(const std::string& rule) : m_Rule(rule) {
+    this->_createTables(ChunkedGrid::CHUNK_SIZE);
+    this->clear();
+}
+
+void Turmite::_createTables(std::ptrdiff_t rowStride) {
+    if (this->m_Rule.empty() || this->m_Rule.size() > std::size_t(MAX_STATES))
+        throw std::runtime_error(R"(Error: rule requires 1 to 256 states in function "Turmite::Turmite")");
+
+    // states beyond the rule never occur, they map to state 0 to keep the tables total
+    this->m_Turn.fill(0);
+    this->m_NextState.fill(0);
+    for (std::size_t state = 0; state < this->m_Rule.size(); ++state) {
+        switch (this->m_Rule[state]) {
+        case '0':
+        case 'L':
+            this->m_Turn[state] = 3;
+            break;
+        case '1':
+        case 'R':
+            this->m_Turn[state] = 1;
+            break;
+        case 'N':
+            this->m_Turn[state] = 0;
+            break;
+        case 'U':
+            this->m_Turn[state] = 2;
+            break;
+        default:
+            throw std::runtime_error(R"(Error: invalid character in rule ")" + this->m_Rule +
+                                     R"(" in function "Turmite::Turmite")");
+        }
+        this->m_NextState[state] = uint8_t((state + 1) % this->m_Rule.size());
+    }
+
+    const std::ptrdiff_t offsets[4] = {-rowStride, 1, rowStride, -1};
+    for (int direction = 0; direction < 4; ++direction) {
+        for (int state = 0; state < MAX_STATES; ++state) {
+            const int next = (direction + this->m_Turn[state]) & 3;
+            this->m_DirectionTable[direction * MAX_STATES + state] = uint16_t(next * MAX_STATES);
+            this->m_OffsetTable[direction * MAX_STATES + state] = offsets[next];
+        }
+    }
+}
+
+Turmite Turmite::FromFile(const std::string& filePath, int width, int height) {
+    return Turmite(readAntString(filePath), width, height);
+}
+Turmite Turmite::FromFile(const std::string& filePath) { return Turmite(readAntString(filePath)); }
+
+void Turmite::setPosition(int64_t x, int64_t y, AbsoluteDirection direction) {
+    const bool outside = this->m_Width && (x < 0 || y < 0 || x >= this->m_Width || y >= this->m_Height);
+    if (outside || direction == AbsoluteDirection::NUM_ABS_DIRS)
+        throw std::runtime_error(R"(Error: invalid position or direction in function "Turmite::setPosition")");
+
+    // the skipped cells of a highway are only valid as long as the ant stays on it
+    if (this->m_Highway.periods)
+        throw std::runtime_error(R"(Error: the ant cannot leave its highway in function "Turmite::setPosition")");
+    this->m_Highway = _Highway();
+    this->_resetHighwayDetection();
+    this->m_X = x;
+    this->m_Y = y;
+    this->m_Direction = int(direction);
+}
+
+void Turmite::clear() {
+    this->m_Cells.assign(std::size_t(this->m_Width) * this->m_Height, 0);
+    this->m_Grid.clear();
+    this->m_Steps = 0;
+    this->m_Highway = _Highway();
+    this->setPosition(this->m_Width / 2, this->m_Height / 2);
+}
+
+void Turmite::setHighwayDetection(bool enabled) {
+    this->m_HighwayDetection = enabled;
+    this->_resetHighwayDetection();
+}
+
+void Turmite::_resetHighwayDetection() {
+    this->m_UnrecordedSteps = 0;
+    this->m_DetectionInterval = RECORDED_STEPS;
+    this->m_Symbols.clear();
+    this->m_Positions.clear();
+    this->m_Candidate = _Highway();
+}
+
+bool Turmite::getHighway(uint64_t& period, int64_t& dx, int64_t& dy) const {
+    period = this->m_Highway.period;
+    dx = this->m_Highway.dx;
+    dy = this->m_Highway.dy;
+    return period != 0;
+}
+
+void Turmite::run(uint64_t steps) {
+    if (this->m_Width)
+        this->_runTorus(steps);
+    else
+        this->_runUnbounded(steps);
+    this->m_Steps += steps;
+}
+
+void Turmite::_runTorus(uint64_t steps) {
+    uint8_t* cells = this->m_Cells.data();
+    int x = int(this->m_X), y = int(this->m_Y);
+    while (steps) {
+        // the ant cannot reach the border within 'distance' steps
+        const int distance = std::min(std::min(x, this->m_Width - 1 - x), std::min(y, this->m_Height - 1 - y));
+        if (distance > 0) {
+            const uint64_t batch = std::min(uint64_t(distance), steps);
+            std::size_t position = std::size_t(y) * this->m_Width + x;
+            _Steps(cells, position, this->m_Direction, batch, this->m_DirectionTable.data(), this->m_OffsetTable.data(),
+                   this->m_NextState.data());
+            x = int(position % this->m_Width);
+            y = int(position / this->m_Width);
+            steps -= batch;
+            continue;
+        }
+
+        // single step at the border, the ant wraps around
+        uint8_t& cell = cells[std::size_t(y) * this->m_Width + x];
+        this->m_Direction = (this->m_Direction + this->m_Turn[cell]) & 3;
+        cell = this->m_NextState[cell];
+        x = (x + DX[this->m_Direction] + this->m_Width) % this->m_Width;
+        y = (y + DY[this->m_Direction] + this->m_Height) % this->m_Height;
+        --steps;
+    }
+    this->m_X = x;
+    this->m_Y = y;
+}
+
+void Turmite::_runUnbounded(uint64_t steps) {
+    // short recorded runs alternate with unrecorded runs of growing length, the schedule, an unfinished recorded run and
+    // an unconfirmed highway carry over to the next call, so the detection does not depend on how the steps are split
+    while (steps) {
+        if (this->m_Highway.period) {
+            this->_runHighway(steps);
+            return;
+        }
+        if (!this->m_HighwayDetection) {
+            this->_runChunked(steps);
+            return;
+        }
+        if (this->m_UnrecordedSteps < this->m_DetectionInterval) {
+            const uint64_t batch = std::min(this->m_DetectionInterval - this->m_UnrecordedSteps, steps);
+            this->_runChunked(batch);
+            steps -= batch;
+            this->m_UnrecordedSteps += batch;
+            continue;
+        }
+
+        _Highway& candidate = this->m_Candidate;
+        if (!candidate.period) {
+            const uint64_t batch = std::min(RECORDED_STEPS - uint64_t(this->m_Symbols.size()), steps);
+            this->_runRecorded(batch, &this->m_Symbols, &this->m_Positions);
+            steps -= batch;
+            if (this->m_Symbols.size() < RECORDED_STEPS)
+                return;
+            if (this->_findHighway())
+                continue;
+        } else {
+            // confirmation: one more period of the candidate
+            const uint64_t batch = std::min(candidate.period - candidate.phase, steps);
+            this->_runRecorded(batch, nullptr, &this->m_Positions);
+            steps -= batch;
+            candidate.phase += batch;
+            if (candidate.phase < candidate.period)
+                return;
+            if (this->_confirmHighway())
+                continue;
+        }
+
+        // no highway (so far), the next recorded run starts after twice as many steps
+        const uint64_t interval = std::min(2 * this->m_DetectionInterval, MAX_UNRECORDED_STEPS);
+        this->_resetHighwayDetection();
+        this->m_DetectionInterval = interval;
+    }
+}
+
+void Turmite::_runChunked(uint64_t steps) {
+    constexpr const int SIZE = ChunkedGrid::CHUNK_SIZE;
+    while (steps) {
+        // the current chunk is cached by the grid, the steps within a chunk work like on a torus of the chunk size
+        ChunkedGrid::Chunk& chunk =
+            this->m_Grid.getChunk(ChunkedGrid::ChunkCoordinate(this->m_X), ChunkedGrid::ChunkCoordinate(this->m_Y));
+        const int x = ChunkedGrid::LocalCoordinate(this->m_X);
+        const int y = ChunkedGrid::LocalCoordinate(this->m_Y);
+        const int distance = std::min(std::min(x, SIZE - 1 - x), std::min(y, SIZE - 1 - y));
+        if (distance > 0) {
+            const uint64_t batch = std::min(uint64_t(distance), steps);
+            std::size_t position = std::size_t(y) * SIZE + x;
+            _Steps(chunk.cells, position, this->m_Direction, batch, this->m_DirectionTable.data(),
+                   this->m_OffsetTable.data(), this->m_NextState.data());
+            this->m_X += int(position % SIZE) - x;
+            this->m_Y += int(position / SIZE) - y;
+            steps -= batch;
+            continue;
+        }
+
+        // single step at the chunk border, the ant may enter the neighbouring chunk
+        uint8_t& cell = chunk.cells[y * SIZE + x];
+        this->m_Direction = (this->m_Direction + this->m_Turn[cell]) & 3;
+        cell = this->m_NextState[cell];
+        this->m_X += DX[this->m_Direction];
+        this->m_Y += DY[this->m_Direction];
+        --steps;
+    }
+}
+
+void Turmite::_runRecorded(uint64_t steps, std::vector<uint16_t>* symbols, std::vector<int64_t>* positions) {
+    for (uint64_t i = 0; i < steps; ++i) {
+        ChunkedGrid::Chunk& chunk =
+            this->m_Grid.getChunk(ChunkedGrid::ChunkCoordinate(this->m_X), ChunkedGrid::ChunkCoordinate(this->m_Y));
+        const int x = ChunkedGrid::LocalCoordinate(this->m_X), y = ChunkedGrid::LocalCoordinate(this->m_Y);
+        uint8_t& cell = chunk.cells[y * ChunkedGrid::CHUNK_SIZE + x];
+        if (symbols)
+            symbols->push_back(uint16_t(cell | this->m_Direction << 8));
+        if (positions) {
+            positions->push_back(this->m_X);
+            positions->push_back(this->m_Y);
+        }
+
+        this->m_Direction = (this->m_Direction + this->m_Turn[cell]) & 3;
+        cell = this->m_NextState[cell];
+        this->m_X += DX[this->m_Direction];
+        this->m_Y += DY[this->m_Direction];
+    }
+}
+
+bool Turmite::_findHighway() {
+    const std::vector<uint16_t>& symbols = this->m_Symbols;
+    const std::vector<int64_t>& positions = this->m_Positions;
+
+    // periodic tail of the (state, direction) sequence: prefix function of the reversed sequence, the longest prefix
+    // with at least three repetitions of its period
+    const std::size_t n = symbols.size();
+    std::vector<uint32_t> prefix(n, 0);
+    for (std::size_t i = 1; i < n; ++i) {
+        uint32_t k = prefix[i - 1];
+        while (k && symbols[n - 1 - i] != symbols[n - 1 - k])
+            k = prefix[k - 1];
+        prefix[i] = symbols[n - 1 - i] == symbols[n - 1 - k] ? k + 1 : k;
+    }
+    std::size_t period = 0;
+    for (std::size_t length = n; length >= n / 2 && !period; --length) {
+        if (length >= 3 * (length - prefix[length - 1]))
+            period = length - prefix[length - 1];
+    }
+    if (!period)
+        return false;
+
+    // translation and reach of the last period
+    const std::size_t first = n - period;
+    const int64_t dx = this->m_X - positions[2 * first], dy = this->m_Y - positions[2 * first + 1];
+    if (!dx && !dy)
+        return false;
+    int64_t radius = 0;
+    for (std::size_t i = first; i < n; ++i)
+        radius = std::max(radius, std::max(std::abs(positions[2 * i] - positions[2 * first]),
+                                           std::abs(positions[2 * i + 1] - positions[2 * first + 1])));
+    radius = std::max(radius, std::max(std::abs(dx), std::abs(dy))) + 1;
+    if (radius > ChunkedGrid::CHUNK_SIZE * 16)
+        return false;
+
+    // the candidate is confirmed after one more period (see _confirmHighway)
+    _Highway& candidate = this->m_Candidate;
+    candidate.period = period;
+    candidate.dx = dx;
+    candidate.dy = dy;
+    candidate.radius = int(radius);
+    candidate.baseX = this->m_X;
+    candidate.baseY = this->m_Y;
+    candidate.direction = this->m_Direction;
+    candidate.phase = 0;
+    candidate.start = this->_cellsAround(this->m_X, this->m_Y, int(radius));
+    this->m_Positions.clear();
+    return true;
+}
+
+bool Turmite::_confirmHighway() {
+    // one more period translates the cells around the ant, the ant stays within 'radius'
+    const _Highway& candidate = this->m_Candidate;
+    const std::vector<int64_t>& positions = this->m_Positions;
+    const int64_t x0 = candidate.baseX, y0 = candidate.baseY, dx = candidate.dx, dy = candidate.dy;
+    const int64_t radius = candidate.radius;
+    if (this->m_Direction != candidate.direction || this->m_X - x0 != dx || this->m_Y - y0 != dy)
+        return false;
+    for (std::size_t i = 0; i < candidate.period; ++i) {
+        if (std::abs(positions[2 * i] - x0) > radius || std::abs(positions[2 * i + 1] - y0) > radius)
+            return false;
+    }
+    if (this->_cellsAround(this->m_X, this->m_Y, int(radius)) != candidate.start)
+        return false;
+
+    // all cells the ant will ever visit (around the future period starts) are 0 or were visited during the last period
+    for (const ChunkedGrid::Chunk* chunk : this->m_Grid.getChunks()) {
+        const int64_t chunkX = chunk->x * ChunkedGrid::CHUNK_SIZE, chunkY = chunk->y * ChunkedGrid::CHUNK_SIZE;
+        int64_t firstPeriod, lastPeriod;
+        if (!_Periods(chunkX, chunkY, chunkX + ChunkedGrid::CHUNK_SIZE - 1, chunkY + ChunkedGrid::CHUNK_SIZE - 1, this->m_X,
+                      this->m_Y, dx, dy, radius, firstPeriod, lastPeriod) ||
+            lastPeriod < 0)
+            continue;
+        for (int y = 0; y < ChunkedGrid::CHUNK_SIZE; ++y) {
+            for (int x = 0; x < ChunkedGrid::CHUNK_SIZE; ++x) {
+                const int64_t cellX = chunkX + x, cellY = chunkY + y;
+                if (!chunk->cells[y * ChunkedGrid::CHUNK_SIZE + x] ||
+                    (std::abs(cellX - x0) <= radius && std::abs(cellY - y0) <= radius))
+                    continue;
+                if (_Periods(cellX, cellY, cellX, cellY, this->m_X, this->m_Y, dx, dy, radius, firstPeriod, lastPeriod) &&
+                    lastPeriod >= 0)
+                    return false;
+            }
+        }
+    }
+
+    _Highway& highway = this->m_Highway;
+    highway = candidate;
+    highway.baseX = this->m_X;
+    highway.baseY = this->m_Y;
+    highway.periods = 0;
+    highway.phase = 0;
+    highway.end = this->_cellsAround(x0, y0, int(radius));
+    this->_resetHighwayDetection();
+    return true;
+}
+
+void Turmite::_runHighway(uint64_t steps) {
+    _Highway& highway = this->m_Highway;
+    if (highway.phase) {
+        const uint64_t batch = std::min(steps, highway.period - highway.phase);
+        this->_runChunked(batch);
+        steps -= batch;
+        highway.phase += batch;
+        if (highway.phase < highway.period)
+            return;
+
+        // the period was simulated, its cells equal the cells of a skipped period
+        ++highway.periods;
+        highway.phase = 0;
+    }
+
+    // skipped periods: only the cells around the start of the next period are stored
+    const uint64_t skipped = steps / highway.period;
+    if (skipped) {
+        highway.periods += skipped;
+        this->m_X = highway.baseX + int64_t(highway.periods) * highway.dx;
+        this->m_Y = highway.baseY + int64_t(highway.periods) * highway.dy;
+        const int size = 2 * highway.radius + 1;
+        for (int y = 0; y < size; ++y)
+            for (int x = 0; x < size; ++x)
+                this->m_Grid.set(this->m_X - highway.radius + x, this->m_Y - highway.radius + y, highway.start[y * size + x]);
+        steps -= skipped * highway.period;
+    }
+
+    this->_runChunked(steps);
+    highway.phase = steps;
+}
+
+std::vector<uint8_t> Turmite::_cellsAround(int64_t x, int64_t y, int radius) const {
+    std::vector<uint8_t> cells;
+    cells.reserve(std::size_t(2 * radius + 1) * (2 * radius + 1));
+    for (int64_t cellY = y - radius; cellY <= y + radius; ++cellY)
+        for (int64_t cellX = x - radius; cellX <= x + radius; ++cellX)
+            cells.push_back(this->m_Grid.get(cellX, cellY));
+    return cells;
+}
+
+int64_t Turmite::_Highway::lastPeriod(int64_t x, int64_t y) const {
+    int64_t first, last;
+    if (!this->periods || !_Periods(x, y, x, y, this->baseX, this->baseY, this->dx, this->dy, this->radius, first, last))
+        return -1;
+
+    // cells around the start of the current period belong to the grid
+    return last < 0 || last >= int64_t(this->periods) ? -1 : last;
+}
+
+uint64_t Turmite::getSteps() const { return this->m_Steps; }
+int64_t Turmite::getX() const { return this->m_X; }
+int64_t Turmite::getY() const { return this->m_Y; }
+Turmite::AbsoluteDirection Turmite::getDirection() const { return AbsoluteDirection(this->m_Direction); }
+bool Turmite::isUnbounded() const { return !this->m_Width; }
+int Turmite::getWidth() const { return this->m_Width; }
+int Turmite::getHeight() const { return this->m_Height; }
+const std::string& Turmite::getRule() const { return this->m_Rule; }
+int Turmite::getNumStates() const { return int(this->m_Rule.size()); }
+const std::vector<uint8_t>& Turmite::getCells() const { return this->m_Cells; }
+const ChunkedGrid& Turmite::getGrid() const { return this->m_Grid; }
+
+uint8_t Turmite::getState(int64_t x, int64_t y) const {
+    if (!this->m_Width) {
+        const _Highway& highway = this->m_Highway;
+        const int64_t period = highway.lastPeriod(x, y);
+        if (period < 0)
+            return this->m_Grid.get(x, y);
+        const int64_t localX = x - (highway.baseX + period * highway.dx) + highway.radius;
+        const int64_t localY = y - (highway.baseY + period * highway.dy) + highway.radius;
+        return highway.end[std::size_t(localY * (2 * highway.radius + 1) + localX)];
+    }
+    if (x < 0 || y < 0 || x >= this->m_Width || y >= this->m_Height)
+        return 0;
+    return this->m_Cells[std::size_t(y) * this->m_Width + std::size_t(x)];
+}
+
+bool Turmite::getBounds(int64_t& minX, int64_t& minY, int64_t& maxX, int64_t& maxY) const {
+    if (this->m_Width) {
+        bool found = false;
+        for (int y = 0; y < this->m_Height; ++y) {
+            for (int x = 0; x < this->m_Width; ++x) {
+                if (!this->m_Cells[std::size_t(y) * this->m_Width + x])
+                    continue;
+                minX = found ? std::min(minX, int64_t(x)) : x;
+                maxX = found ? std::max(maxX, int64_t(x)) : x;
+                minY = found ? minY : y;
+                maxY = y;
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    bool found = this->m_Grid.getBounds(minX, minY, maxX, maxY);
+    const _Highway& highway = this->m_Highway;
+    if (highway.periods) {
+        // squares around the first and the last skipped period start
+        const int64_t last = int64_t(highway.periods) - 1;
+        const int64_t x0 = highway.baseX, x1 = highway.baseX + last * highway.dx;
+        const int64_t y0 = highway.baseY, y1 = highway.baseY + last * highway.dy;
+        minX = std::min(found ? minX : x0, std::min(x0, x1) - highway.radius);
+        maxX = std::max(found ? maxX : x0, std::max(x0, x1) + highway.radius);
+        minY = std::min(found ? minY : y0, std::min(y0, y1) - highway.radius);
+        maxY = std::max(found ? maxY : y0, std::max(y0, y1) + highway.radius);
+        found = true;
+    }
+    return found;
+}
+
+uint64_t Turmite::getPopulation() const {
+    if (this->m_Width)
+        return uint64_t(this->m_Cells.size() - std::count(this->m_Cells.begin(), this->m_Cells.end(), uint8_t(0)));
+
+    // cells of the grid, which are not covered by skipped periods
+    const _Highway& highway = this->m_Highway;
+    uint64_t population = 0;
+    for (const ChunkedGrid::Chunk* chunk : this->m_Grid.getChunks()) {
+        const int64_t chunkX = chunk->x * ChunkedGrid::CHUNK_SIZE, chunkY = chunk->y * ChunkedGrid::CHUNK_SIZE;
+        int64_t first, last;
+        const bool covered = highway.periods && _Periods(chunkX, chunkY, chunkX + ChunkedGrid::CHUNK_SIZE - 1,
+                                                         chunkY + ChunkedGrid::CHUNK_SIZE - 1, highway.baseX,
+                                                         highway.baseY, highway.dx, highway.dy, highway.radius, first, last);
+        for (int y = 0; y < ChunkedGrid::CHUNK_SIZE; ++y) {
+            for (int x = 0; x < ChunkedGrid::CHUNK_SIZE; ++x)
+                population += chunk->cells[y * ChunkedGrid::CHUNK_SIZE + x] &&
+                              (!covered || highway.lastPeriod(chunkX + x, chunkY + y) < 0);
+        }
+    }
+
+    // a cell of a skipped period is counted with the last period covering it, i.e. the cell is not covered by the square
+    // of the next period (squares of consecutive periods overlap along the highway only)
+    if (highway.periods) {
+        const int side = 2 * highway.radius + 1;
+        uint64_t perPeriod = 0;
+        for (int y = 0; y < side; ++y) {
+            for (int x = 0; x < side; ++x) {
+                const int64_t nextX = x - highway.dx, nextY = y - highway.dy;
+                perPeriod += highway.end[std::size_t(y) * side + x] &&
+                             (nextX < 0 || nextY < 0 || nextX >= side || nextY >= side);
+            }
+        }
+        population += perPeriod * highway.periods;
+    }
+    return population;
+}
+
+void Turmite::render(WindowRasterized& window, const std::vector<Color>& palette) const {
+    if (this->m_Width) {
+        this->render(window, palette, 0, 0, this->m_Width, this->m_Height);
+        return;
+    }
+
+    int64_t minX, minY, maxX, maxY;
+    if (!this->getBounds(minX, minY, maxX, maxY))
+        minX = maxX = this->m_X, minY = maxY = this->m_Y;
+    this->render(window, palette, minX, minY, maxX - minX + 1, maxY - minY + 1);
+}
+
+void Turmite::render(WindowRasterized& window, const std::vector<Color>& palette, int64_t minX, int64_t minY,
+                     int64_t columns, int64_t rows) const {
+    this->render(window.getImage(), palette, minX, minY, columns, rows);
+}
+
+void Turmite::render(cv::Mat& image, const std::vector<Color>& palette, int64_t minX, int64_t minY, int64_t columns,
+                     int64_t rows) const {
+    if (!this->m_Width && !this->m_Highway.periods) {
+        this->m_Grid.render(image, palette, minX, minY, columns, rows);
+        return;
+    }
+    if (palette.empty())
+        throw std::runtime_error(R"(Error: empty palette in function "Turmite::render")");
+    if (columns <= 0 || rows <= 0)
+        throw std::runtime_error(R"(Error: empty region in function "Turmite::render")");
+
+    for (int row = 0; row < image.rows; ++row) {
+        const int64_t y = minY + int64_t(double(row) * rows / image.rows);
+        cv::Vec3b* pixel = image.ptr<cv::Vec3b>(row);
+        for (int col = 0; col < image.cols; ++col) {
+            const Color& c = palette[this->getState(minX + int64_t(double(col) * columns / image.cols), y) % palette.size()];
+            pixel[col][0] = c.b;
+            pixel[col][1] = c.g;
+            pixel[col][2] = c.r;
+        }
+    }
+}
+} // namespace cf
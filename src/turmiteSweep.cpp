@@ -0,0 +1,175 @@
+#include "turmiteSweep.h"
+#include "internal.hpp"
+
+#include <chrono>
+#include <fstream>
+
+namespace cf {
+
+namespace {
+constexpr const uint64_t BATCH_STEPS = 1 << 24; // steps between two checks of the memory limit
+} // namespace
+
+TurmiteSweep::TurmiteSweep() = default;
+
+void TurmiteSweep::addRule(const std::string& rule, const std::string& name) {
+    if (rule.empty() || rule.size() > std::size_t(Turmite::MAX_STATES))
+        throw std::runtime_error(R"(Error: invalid rule in function "TurmiteSweep::addRule")");
+    this->m_Rules.emplace_back(name.empty() ? rule : name, rule);
+}
+
+void TurmiteSweep::addFile(const std::string& filePath) {
+    const std::size_t begin = filePath.find_last_of("/\\") == std::string::npos ? 0 : filePath.find_last_of("/\\") + 1;
+    const std::size_t end = filePath.find_last_of('.');
+    this->addRule(readAntString(filePath),
+                  filePath.substr(begin, end == std::string::npos || end < begin ? std::string::npos : end - begin));
+}
+
+void TurmiteSweep::addGeneratedRules(int numStates) {
+    if (numStates < 1 || numStates > 24)
+        throw std::runtime_error(R"(Error: invalid number of states in function "TurmiteSweep::addGeneratedRules")");
+    for (uint32_t bits = 0; bits < (1u << (numStates - 1)); ++bits) {
+        std::string rule(std::size_t(numStates), '1');
+        for (int state = 1; state < numStates; ++state)
+            rule[std::size_t(state)] = (bits >> (numStates - 1 - state)) & 1 ? '1' : '0';
+        this->addRule(rule);
+    }
+}
+
+std::size_t TurmiteSweep::getNumRules() const { return this->m_Rules.size(); }
+
+void TurmiteSweep::setStepBudget(uint64_t steps) { this->m_StepBudget = steps; }
+
+void TurmiteSweep::setMemoryLimit(std::size_t bytes) { this->m_MemoryLimit = bytes; }
+
+void TurmiteSweep::setNumThreads(unsigned numThreads) { this->m_NumThreads = numThreads; }
+
+void TurmiteSweep::setThumbnails(int size, const std::vector<Color>& palette, const ThumbnailCallback& onThumbnail) {
+    if (size < 0)
+        throw std::runtime_error(R"(Error: invalid thumbnail size in function "TurmiteSweep::setThumbnails")");
+    if (size && (palette.empty() || !onThumbnail))
+        throw std::runtime_error(R"(Error: palette and callback required in function "TurmiteSweep::setThumbnails")");
+    this->m_ThumbnailSize = size;
+    this->m_Palette = palette;
+    this->m_OnThumbnail = onThumbnail;
+}
+
+void TurmiteSweep::setThumbnails(int size, const std::vector<Color>& palette, const std::string& directory,
+                                 const std::string& extension) {
+    std::string prefix = directory;
+    if (!prefix.empty() && prefix.back() != '/' && prefix.back() != '\\')
+        prefix += '/';
+    this->setThumbnails(size, palette, [prefix, extension](const Result& result, const cv::Mat& image) {
+        const std::string filePath = prefix + result.name + extension;
+        if (!cv::imwrite(filePath, image))
+            throw std::runtime_error("Error: could not write \"" + filePath + R"(" in function "TurmiteSweep::run")");
+    });
+}
+
+void TurmiteSweep::setQueueSize(std::size_t thumbnails) {
+    if (!thumbnails)
+        throw std::runtime_error(R"(Error: queue requires at least one thumbnail in function "TurmiteSweep::setQueueSize")");
+    this->m_QueueSize = thumbnails;
+}
+
+TurmiteSweep::Result TurmiteSweep::_run(std::size_t index, cv::Mat* thumbnail) const {
+    Result result;
+    result.name = this->m_Rules[index].first;
+    result.rule = this->m_Rules[index].second;
+
+    const auto start = std::chrono::steady_clock::now();
+    Turmite turmite(result.rule);
+    uint64_t period;
+    int64_t dx, dy;
+    while (turmite.getSteps() < this->m_StepBudget && turmite.getGrid().getMemoryUsage() <= this->m_MemoryLimit) {
+        // a highway does not grow the grid anymore, the remaining steps are skipped at once
+        const uint64_t remaining = this->m_StepBudget - turmite.getSteps();
+        turmite.run(turmite.getHighway(period, dx, dy) ? remaining : std::min(remaining, BATCH_STEPS));
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    result.steps = turmite.getSteps();
+    result.empty = !turmite.getBounds(result.minX, result.minY, result.maxX, result.maxY);
+    result.population = turmite.getPopulation();
+    if (turmite.getHighway(period, dx, dy)) {
+        result.highwayPeriod = period;
+        result.highwayDx = dx;
+        result.highwayDy = dy;
+    }
+
+    // square region centered on the bounding box
+    if (thumbnail) {
+        const int64_t width = result.empty ? 1 : result.maxX - result.minX + 1;
+        const int64_t height = result.empty ? 1 : result.maxY - result.minY + 1;
+        const int64_t side = std::max(width, height);
+        const int64_t minX = result.empty ? turmite.getX() : result.minX - (side - width) / 2;
+        const int64_t minY = result.empty ? turmite.getY() : result.minY - (side - height) / 2;
+        turmite.render(*thumbnail, this->m_Palette, minX, minY, side, side);
+    }
+    return result;
+}
+
+std::vector<TurmiteSweep::Result> TurmiteSweep::run() const {
+    std::vector<Result> results(this->m_Rules.size());
+    if (!this->m_ThumbnailSize) {
+        internal::_ParallelFor(results.size(), this->m_NumThreads,
+                               [&](unsigned, std::size_t index) { results[index] = this->_run(index, nullptr); });
+        return results;
+    }
+
+    // writer thread, e.g. image encoding
+    internal::_BoundedQueue<std::pair<std::size_t, cv::Mat>> queue(this->m_QueueSize);
+    std::exception_ptr writerException;
+    std::thread writer([&]() {
+        try {
+            std::pair<std::size_t, cv::Mat> thumbnail;
+            while (queue.pop(thumbnail))
+                this->m_OnThumbnail(results[thumbnail.first], thumbnail.second);
+        } catch (...) {
+            writerException = std::current_exception();
+            queue.close();
+        }
+    });
+
+    try {
+        internal::_ParallelFor(results.size(), this->m_NumThreads, [&](unsigned, std::size_t index) {
+            cv::Mat thumbnail(this->m_ThumbnailSize, this->m_ThumbnailSize, CV_8UC3);
+            results[index] = this->_run(index, &thumbnail);
+            if (!queue.push(std::make_pair(index, thumbnail)))
+                throw std::runtime_error(R"(Error: thumbnail writer failed in function "TurmiteSweep::run")");
+        });
+    } catch (...) {
+        // a failed push is caused by the writer, its exception is the actual error
+        queue.close();
+        writer.join();
+        if (writerException)
+            std::rethrow_exception(writerException);
+        throw;
+    }
+
+    queue.close();
+    writer.join();
+    if (writerException)
+        std::rethrow_exception(writerException);
+    return results;
+}
+
+void TurmiteSweep::SaveCSV(const std::string& filePath, const std::vector<Result>& results) {
+    std::ofstream file(filePath);
+    if (!file)
+        throw std::runtime_error("Error: could not open \"" + filePath + R"(" in function "TurmiteSweep::SaveCSV")");
+
+    file << "name,rule,steps,minX,minY,maxX,maxY,population,highwayPeriod,highwayDx,highwayDy,seconds\n";
+    for (const Result& result : results) {
+        file << result.name << ',' << result.rule << ',' << result.steps << ',';
+        if (result.empty)
+            file << ",,,,";
+        else
+            file << result.minX << ',' << result.minY << ',' << result.maxX << ',' << result.maxY << ',';
+        file << result.population << ',' << result.highwayPeriod << ',' << result.highwayDx << ',' << result.highwayDy
+             << ',' << result.seconds << '\n';
+    }
+    if (!file)
+        throw std::runtime_error("Error: could not write \"" + filePath + R"(" in function "TurmiteSweep::SaveCSV")");
+}
+} // namespace cf
@@ -0,0 +1,189 @@
+#include "zoomVideo.h"
+#include "internal.hpp"
+
+#include <cmath>
+
+namespace cf {
+
+namespace {
+constexpr const double TWO_PI = 6.283185307179586;
+constexpr const double LN2 = 0.6931471805599453;
+constexpr const int ROWS_PER_TASK = 16;
+} // namespace
+
+ZoomVideo::ZoomVideo(const EscapeTime& fractal, const ColorMap& colorMap, const std::complex<double>& center)
+    : m_Fractal(fractal), m_ColorMap(colorMap), m_Center(center) {}
+
+void ZoomVideo::setViewWidths(double startWidth, double endWidth) {
+    if (!(startWidth > 0.0 && endWidth > 0.0 && std::isfinite(startWidth) && std::isfinite(endWidth)))
+        throw std::runtime_error(R"(Error: view widths have to be positive in function "ZoomVideo::setViewWidths")");
+    this->m_StartWidth = startWidth;
+    this->m_EndWidth = endWidth;
+}
+
+void ZoomVideo::setQueueSize(std::size_t frames) {
+    if (!frames)
+        throw std::runtime_error(R"(Error: queue requires at least one frame in function "ZoomVideo::setQueueSize")");
+    this->m_QueueSize = frames;
+}
+void ZoomVideo::setNumThreads(unsigned numThreads) { this->m_NumThreads = numThreads; }
+
+ZoomVideo::Layout ZoomVideo::getLayout(int width, int height) const {
+    if (width <= 0 || height <= 0)
+        throw std::runtime_error(R"(Error: invalid frame size in function "ZoomVideo::getLayout")");
+
+    // square samples at the outer radius of the first frame, the map reaches down to a quarter pixel of the last frame
+    Layout layout;
+    layout.halfDiagonal = 0.5 * std::sqrt(double(width) * width + double(height) * height);
+    layout.columns = 16 * int(std::ceil(TWO_PI * layout.halfDiagonal / 16.0));
+    layout.rowsPerStrip = int(std::ceil(layout.columns * LN2 / TWO_PI));
+    layout.rowsPerUnit = layout.rowsPerStrip / LN2;
+    layout.startRadius = std::log(std::max(this->m_StartWidth, this->m_EndWidth) / width * layout.halfDiagonal);
+    const double endRadius = std::log(std::min(this->m_StartWidth, this->m_EndWidth) / width * 0.25);
+    layout.numStrips = std::max(1, int(std::ceil((layout.startRadius - endRadius) / LN2)));
+    return layout;
+}
+
+void ZoomVideo::Layout::strips(double pixelSize, int& first, int& last) const {
+    // one row of margin for the interpolation
+    const double firstRow = this->row(pixelSize * this->halfDiagonal) - 0.5;
+    const double lastRow = this->row(pixelSize * 0.25) + 1.5;
+    first = std::max(0, int(firstRow) / this->rowsPerStrip);
+    last = std::min(this->numStrips - 1, std::max(0, int(lastRow)) / this->rowsPerStrip);
+}
+
+double ZoomVideo::getPixelSize(int width, int frame, int numFrames) const {
+    const double t = numFrames > 1 ? double(frame) / (numFrames - 1) : 0.0;
+    return this->m_StartWidth * std::pow(this->m_EndWidth / this->m_StartWidth, t) / width;
+}
+
+std::size_t ZoomVideo::render(int width, int height, int numFrames, const FrameCallback& onFrame) const {
+    if (width <= 0 || height <= 0 || numFrames <= 0)
+        throw std::runtime_error(R"(Error: invalid frame size or number of frames in function "ZoomVideo::render")");
+
+    const Layout layout = this->getLayout(width, height);
+    const int columns = layout.columns;
+    const int rowsPerStrip = layout.rowsPerStrip;
+    const int numStrips = layout.numStrips;
+    const int numRows = numStrips * rowsPerStrip;
+    const unsigned numThreads = internal::_NumThreads(this->m_NumThreads, std::size_t(-1));
+
+    // missing strips are calculated in parallel, the threads are split among them
+    EscapeTime fractal(this->m_Fractal);
+    ColorMap colorMap(this->m_ColorMap);
+    std::vector<std::vector<uint8_t>> strips(numStrips);
+    std::size_t samples = 0;
+    auto calculateStrips = [&](int first, int last) {
+        std::vector<int> missing;
+        for (int strip = 0; strip < numStrips; ++strip) {
+            if (strip < first || strip > last)
+                std::vector<uint8_t>().swap(strips[strip]); // the frames left this strip
+            else if (strips[strip].empty())
+                missing.push_back(strip);
+        }
+        if (missing.empty())
+            return;
+
+        const unsigned stripThreads = std::max(1u, numThreads / unsigned(missing.size()));
+        fractal.setNumThreads(stripThreads);
+        colorMap.setNumThreads(stripThreads);
+        internal::_ParallelFor(missing.size(), numThreads, [&](unsigned, std::size_t idx) {
+            const int strip = missing[idx];
+            std::vector<std::complex<double>> points;
+            points.reserve(std::size_t(rowsPerStrip) * columns);
+            for (int row = 0; row < rowsPerStrip; ++row) {
+                const double radius = std::exp(layout.startRadius - (strip * rowsPerStrip + row + 0.5) / layout.rowsPerUnit);
+                for (int col = 0; col < columns; ++col)
+                    points.push_back(this->m_Center + std::polar(radius, (col + 0.5) * TWO_PI / columns));
+            }
+
+            EscapeTime::Result result = fractal.calculate(points);
+            result.width = columns;
+            result.height = rowsPerStrip;
+            std::vector<uint8_t> colors(std::size_t(rowsPerStrip) * columns * 3);
+            cv::Mat image(rowsPerStrip, columns, CV_8UC3, colors.data());
+            colorMap.apply(result, image);
+            strips[strip].swap(colors);
+        });
+        samples += missing.size() * std::size_t(rowsPerStrip) * columns;
+    };
+
+    // consumer thread, e.g. the video encoder
+    internal::_BoundedQueue<std::pair<int, cv::Mat>> queue(this->m_QueueSize);
+    std::exception_ptr consumerException;
+    std::thread consumer([&]() {
+        try {
+            std::pair<int, cv::Mat> frame;
+            while (queue.pop(frame))
+                onFrame(frame.first, frame.second);
+        } catch (...) {
+            consumerException = std::current_exception();
+            queue.close();
+        }
+    });
+
+    try {
+        for (int frameIdx = 0; frameIdx < numFrames; ++frameIdx) {
+            const double pixelSize = this->getPixelSize(width, frameIdx, numFrames);
+            int firstStrip, lastStrip;
+            layout.strips(pixelSize, firstStrip, lastStrip);
+            calculateStrips(firstStrip, lastStrip);
+
+            // bilinear interpolation within the map (the angle wraps around)
+            cv::Mat frame(height, width, CV_8UC3);
+            const int numTasks = (height + ROWS_PER_TASK - 1) / ROWS_PER_TASK;
+            internal::_ParallelFor(std::size_t(numTasks), numThreads, [&](unsigned, std::size_t task) {
+                for (int row = int(task) * ROWS_PER_TASK; row < std::min(height, int(task + 1) * ROWS_PER_TASK); ++row) {
+                    cv::Vec3b* pixel = frame.ptr<cv::Vec3b>(row);
+                    const double dy = (0.5 * height - row - 0.5) * pixelSize;
+                    for (int col = 0; col < width; ++col) {
+                        const double dx = (col + 0.5 - 0.5 * width) * pixelSize;
+                        const double radius = std::max(std::sqrt(dx * dx + dy * dy), 0.25 * pixelSize);
+                        const double angle = std::atan2(dy, dx);
+
+                        const double r = layout.row(radius);
+                        const double a = (angle < 0.0 ? angle + TWO_PI : angle) * columns / TWO_PI - 0.5;
+                        const int r0 = std::min(std::max(0, int(std::floor(r))), numRows - 1);
+                        const int r1 = std::min(std::max(0, r0 + 1), numRows - 1);
+                        const int a0 = (int(std::floor(a)) + columns) % columns;
+                        const int a1 = (a0 + 1) % columns;
+                        const float fr = float(std::min(std::max(0.0, r - r0), 1.0));
+                        const float fa = float(a - std::floor(a));
+
+                        const uint8_t* row0 = &strips[r0 / rowsPerStrip][std::size_t(r0 % rowsPerStrip) * columns * 3];
+                        const uint8_t* row1 = &strips[r1 / rowsPerStrip][std::size_t(r1 % rowsPerStrip) * columns * 3];
+                        const uint8_t *c00 = row0 + a0 * 3, *c01 = row0 + a1 * 3;
+                        const uint8_t *c10 = row1 + a0 * 3, *c11 = row1 + a1 * 3;
+                        for (int ch = 0; ch < 3; ++ch) {
+                            const float top = c00[ch] + fa * (c01[ch] - c00[ch]);
+                            const float bottom = c10[ch] + fa * (c11[ch] - c10[ch]);
+                            pixel[col][ch] = uchar(top + fr * (bottom - top) + 0.5f);
+                        }
+                    }
+                }
+            });
+
+            if (!queue.push(std::make_pair(frameIdx, frame)))
+                break; // the consumer failed
+        }
+    } catch (...) {
+        queue.close();
+        consumer.join();
+        throw;
+    }
+
+    queue.close();
+    consumer.join();
+    if (consumerException)
+        std::rethrow_exception(consumerException);
+    return samples;
+}
+
+std::size_t ZoomVideo::render(const std::string& filePath, int width, int height, int numFrames, double fps,
+                              int fourcc) const {
+    cv::VideoWriter writer(filePath, fourcc, fps, cv::Size(width, height), true);
+    if (!writer.isOpened())
+        throw std::runtime_error("Error: could not open \"" + filePath + R"(" in function "ZoomVideo::render")");
+    return this->render(width, height, numFrames, [&](int, const cv::Mat& image) { writer.write(image); });
+}
+} // namespace cf
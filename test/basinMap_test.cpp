@@ -0,0 +1,53 @@
+#include "basinMap.h"
+#include "gtest/gtest.h"
+
+TEST(BasinMap, TwoFixedPoints) {
+    // x' = sign(x) * sqrt(|x|), y' = 0: stable fixed points (-1, 0) and (1, 0), the separatrix x = 0 is unstable
+    cf::OrbitMap map;
+    map.factors[5] = 1.0;
+    map.factors[6] = 1.0;
+
+    for (const bool reuse : {true, false}) {
+        cf::BasinMap basins(map);
+        basins.setLabelReuse(reuse);
+        basins.setNumThreads(3);
+        const int width = 80, height = 40; // no pixel center on the separatrix
+        const cf::BasinMap::Result result = basins.calculate(width, height, {-2.f, 2.f}, {-1.f, 1.f});
+        ASSERT_EQ(result.attractors.size(), 2u) << reuse;
+
+        const int32_t left = result.labels[0], right = result.labels[width - 1];
+        ASSERT_NE(left, right);
+        ASSERT_GT(left, 0); // 0: diverged
+        ASSERT_GT(right, 0);
+        ASSERT_NEAR(result.attractors[left - 1].front().x, -1.0, 1e-5);
+        ASSERT_NEAR(result.attractors[right - 1].front().x, 1.0, 1e-5);
+        for (int row = 0; row < height; ++row) {
+            for (int col = 0; col < width; ++col)
+                ASSERT_EQ(result.labels[std::size_t(row) * width + col], col < width / 2 ? left : right) << row << ", " << col;
+        }
+        if (reuse) {
+            ASSERT_GT(result.reusedLabels, 0u);
+        }
+    }
+}
+
+TEST(BasinMap, ChaoticAttractor) {
+    // Henon: every bounded orbit ends on the same chaotic attractor
+    cf::OrbitMap henon;
+    henon.factors[0] = henon.factors[1] = 1.0;
+    henon.factors[3] = -1.4;
+    henon.factors[9] = 0.3;
+
+    for (const bool reuse : {true, false}) {
+        cf::BasinMap basins(henon);
+        basins.setLabelReuse(reuse);
+        const int width = 96, height = 64;
+        const cf::BasinMap::Result result = basins.calculate(width, height, {-2.f, 2.f}, {-1.f, 1.f});
+        ASSERT_EQ(result.attractors.size(), 1u) << reuse;
+        const std::ptrdiff_t bounded = std::count(result.labels.begin(), result.labels.end(), 1);
+        const std::ptrdiff_t diverged = std::count(result.labels.begin(), result.labels.end(), int32_t(cf::BasinMap::DIVERGED));
+        ASSERT_GT(bounded, 0);
+        ASSERT_GT(diverged, 0);
+        ASSERT_EQ(bounded + diverged, std::ptrdiff_t(result.labels.size()));
+    }
+}
@@ -0,0 +1,48 @@
+#include "bifurcationDiagram.h"
+#include "gtest/gtest.h"
+
+TEST(BifurcationDiagram, PeriodTwo) {
+    // the logistic map at r = 3.2 as x' = 1 - mu * x^2 (x_logistic = 1/2 + (r - 2)/4 * x, mu = r * (r - 2)/4 = 0.96),
+    // every column sweeps mu (factor 'd') around 0.96, the orbit of period 2 fills exactly two rows per column
+    cf::OrbitMap map;
+    map.factors[0] = 1.0;
+    map.factors[9] = 1.0; // y' = x -> the y coordinate is the previous x
+
+    const int width = 5, height = 64;
+    const cf::Interval rangeX = {-0.965f, -0.955f}, rangeY = {-1.f, 1.f};
+    const std::size_t plotted = 10000;
+    for (const double tolerance : {1e-10, 0.0}) {
+        for (const auto coordinate : {cf::BifurcationDiagram::Coordinate::X, cf::BifurcationDiagram::Coordinate::Y}) {
+            cf::BifurcationDiagram diagram(map, {0.1, 0.0}, 3);
+            diagram.setIterations(1000, plotted);
+            diagram.setCycleTolerance(tolerance);
+            diagram.setPlottedCoordinate(coordinate);
+            diagram.setNumThreads(2);
+            cf::DensityCanvas canvas(width, height, rangeX, rangeY);
+            diagram.calculate(canvas);
+
+            for (int col = 0; col < width; ++col) {
+                // period 2 orbit: x = (1 +- sqrt(4 mu - 3)) / (2 mu)
+                const double mu = -(rangeX.min + (col + 0.5) * (double(rangeX.max) - double(rangeX.min)) / width);
+                const double root = std::sqrt(4.0 * mu - 3.0);
+                const int upper = int((rangeY.max - (1.0 + root) / (2.0 * mu)) * height / 2.0);
+                const int lower = int((rangeY.max - (1.0 - root) / (2.0 * mu)) * height / 2.0);
+                ASSERT_LT(upper, lower);
+
+                uint64_t sum = 0;
+                for (int row = 0; row < height; ++row) {
+                    if (row != upper && row != lower) {
+                        ASSERT_EQ(canvas.getCount(col, row), 0u) << col << ", " << row;
+                    }
+                    sum += canvas.getCount(col, row);
+                }
+                // both points are visited equally often (the replayed cycle weights an even remainder only)
+                ASSERT_LE(std::abs(int64_t(canvas.getCount(col, upper)) - int64_t(canvas.getCount(col, lower))), 1);
+                ASSERT_LE(sum, plotted);
+                ASSERT_GE(sum, plotted - 1);
+            }
+        }
+    }
+
+    ASSERT_THROW(cf::BifurcationDiagram(map, {0.0, 0.0}, cf::OrbitMap::NUM_FACTORS), std::out_of_range);
+}
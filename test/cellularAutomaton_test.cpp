@@ -0,0 +1,126 @@
+#include "cellularAutomaton.h"
+#include "life.h"
+#include "gtest/gtest.h"
+
+namespace {
+/**
+ * @brief stepReference Cell by cell generation of a Life-like or Generations rule
+ */
+std::vector<uint8_t> stepReference(const std::vector<uint8_t>& cells, int width, int height, bool torus,
+                                   const cf::CellularAutomaton::Rule& rule) {
+    std::vector<uint8_t> next(cells.size(), 0);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int count = 0;
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    int nx = x + dx, ny = y + dy;
+                    if (torus) {
+                        nx = (nx + width) % width;
+                        ny = (ny + height) % height;
+                    } else if (nx < 0 || ny < 0 || nx >= width || ny >= height) {
+                        continue;
+                    }
+                    count += (dx || dy) && cells[std::size_t(ny) * width + nx] == 1;
+                }
+            }
+            const uint8_t state = cells[std::size_t(y) * width + x];
+            uint8_t& result = next[std::size_t(y) * width + x];
+            if (state == 0)
+                result = (rule.birth >> count) & 1;
+            else if (state == 1 && ((rule.survival >> count) & 1))
+                result = 1;
+            else
+                result = state + 1 < rule.states ? uint8_t(state + 1) : uint8_t(0);
+        }
+    }
+    return next;
+}
+
+void compare(const std::string& rule, int width, int height, cf::CellularAutomaton::Topology topology,
+             unsigned numThreads) {
+    cf::CellularAutomaton automaton(width, height, rule, topology);
+    automaton.setNumThreads(numThreads);
+    automaton.randomize(0.3, 11);
+    std::vector<uint8_t> cells = automaton.getCells();
+    for (int generation = 0; generation < 30; ++generation) {
+        automaton.step();
+        cells = stepReference(cells, width, height, topology == cf::CellularAutomaton::Topology::TORUS,
+                              automaton.getRule());
+        ASSERT_EQ(automaton.getCells(), cells) << rule << ' ' << width << 'x' << height << " generation " << generation;
+    }
+    ASSERT_EQ(automaton.getPopulation(), uint64_t(cells.size() - std::count(cells.begin(), cells.end(), uint8_t(0))));
+}
+} // namespace
+
+TEST(CellularAutomaton, ParseRule) {
+    using Rule = cf::CellularAutomaton::Rule;
+    ASSERT_EQ(Rule::Parse("B3/S23"), Rule());
+    ASSERT_EQ(Rule::Parse("b3s23"), Rule());
+    ASSERT_EQ(Rule::Parse("23/3"), Rule());
+    ASSERT_EQ(Rule::Parse("B36/S23").birth, cf::ca::counts(3, 6));
+    ASSERT_EQ(Rule::Parse("B2/S/C3").states, 3);
+    ASSERT_EQ(Rule::Parse("B2/S/C3").survival, 0);
+    ASSERT_EQ(Rule::Parse("345/2/4"), Rule::Parse("B2/S345/C4"));
+    ASSERT_EQ(Rule::Parse("B2/S345/C4").toString(), "B2/S345/C4");
+    ASSERT_EQ(Rule::Parse("S34678B3678").toString(), "B3678/S34678");
+
+    for (const char* invalid : {"", "B9/S23", "B3/S23/C1", "B3/S23/C257", "B3", "X3/S23", "3/2/3/4", "23"})
+        ASSERT_THROW(Rule::Parse(invalid), std::runtime_error) << invalid;
+}
+
+TEST(CellularAutomaton, MatchesReference) {
+    // pre-instantiated kernels and the generic kernel
+    for (const char* rule :
+         {"B3/S23", "B36/S23", "B3678/S34678", "B2/S", "B2/S/C3", "B2/S345/C4", "B34/S34", "B1357/S02468/C5", "B0/S8"}) {
+        compare(rule, 64, 48, cf::CellularAutomaton::Topology::TORUS, 2);
+        compare(rule, 37, 70, cf::CellularAutomaton::Topology::PLANE, 3);
+    }
+    compare("B3/S23", 1, 1, cf::CellularAutomaton::Topology::TORUS, 1);
+    compare("B2/S/C3", 5, 130, cf::CellularAutomaton::Topology::PLANE, 4);
+}
+
+TEST(CellularAutomaton, Dispatch) {
+    cf::CellularAutomaton automaton(32, 32);
+    ASSERT_TRUE(automaton.hasCompiledKernel());
+    for (const char* rule : {"B36/S23", "B3678/S34678", "B2/S", "B2/S/C3", "345/2/4"}) {
+        automaton.setRule(rule);
+        ASSERT_TRUE(automaton.hasCompiledKernel()) << rule;
+    }
+    automaton.setRule("B34/S34");
+    ASSERT_FALSE(automaton.hasCompiledKernel());
+
+    // a compile time rule, which is not pre-instantiated, matches the generic kernel of the same rule
+    cf::CellularAutomaton compiled(96, 64), generic(96, 64, "B34/S34");
+    compiled.setRule<cf::ca::StaticRule<cf::ca::counts(3, 4), cf::ca::counts(3, 4)>>();
+    ASSERT_TRUE(compiled.hasCompiledKernel());
+    ASSERT_EQ(compiled.getRule(), generic.getRule());
+    compiled.randomize(0.4, 3);
+    generic.randomize(0.4, 3);
+    compiled.step(50);
+    generic.step(50);
+    ASSERT_EQ(compiled.getCells(), generic.getCells());
+
+    // fewer states: the dying cells beyond the new rule die
+    automaton.setRule("B2/S345/C4");
+    automaton.set(3, 3, 3);
+    automaton.setRule("B2/S/C3");
+    ASSERT_EQ(automaton.get(3, 3), 0);
+    ASSERT_THROW(automaton.set(3, 3, 3), std::runtime_error);
+}
+
+TEST(CellularAutomaton, MatchesLife) {
+    cf::Life life(256, 96);
+    cf::CellularAutomaton automaton(256, 96);
+    life.randomize(0.5, 5);
+    for (int y = 0; y < 96; ++y)
+        for (int x = 0; x < 256; ++x)
+            automaton.set(x, y, life.get(x, y));
+    life.step(100);
+    automaton.step(100);
+    for (int y = 0; y < 96; ++y)
+        for (int x = 0; x < 256; ++x)
+            ASSERT_EQ(automaton.get(x, y), uint8_t(life.get(x, y))) << x << ", " << y;
+    ASSERT_EQ(automaton.getPopulation(), life.getPopulation());
+    ASSERT_EQ(automaton.getGeneration(), 100u);
+}
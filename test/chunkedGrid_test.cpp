@@ -0,0 +1,53 @@
+#include "chunkedGrid.h"
+#include "gtest/gtest.h"
+
+TEST(ChunkedGrid, SetGet) {
+    cf::ChunkedGrid grid;
+    ASSERT_EQ(grid.get(5, -7), 0);
+    ASSERT_EQ(grid.getNumChunks(), std::size_t(0)); // reading does not allocate
+
+    // cells around the origin and far away (negative coordinates belong to the chunks -1, -2, ...)
+    const int64_t far = int64_t(1) << 40;
+    grid.set(0, 0, 1);
+    grid.set(-1, -1, 2);
+    grid.set(-64, 63, 3);
+    grid.set(far, -far, 4);
+    ASSERT_EQ(grid.get(0, 0), 1);
+    ASSERT_EQ(grid.get(-1, -1), 2);
+    ASSERT_EQ(grid.get(-64, 63), 3);
+    ASSERT_EQ(grid.get(far, -far), 4);
+    ASSERT_EQ(grid.get(1, 0), 0);
+    ASSERT_EQ(grid.getNumChunks(), std::size_t(4));
+
+    int64_t minX, minY, maxX, maxY;
+    ASSERT_TRUE(grid.getBounds(minX, minY, maxX, maxY));
+    ASSERT_EQ(minX, -64);
+    ASSERT_EQ(maxX, far);
+    ASSERT_EQ(minY, -far);
+    ASSERT_EQ(maxY, 63);
+}
+
+TEST(ChunkedGrid, GrowCopyClear) {
+    // many chunks -> the directory grows several times
+    cf::ChunkedGrid grid;
+    for (int64_t i = -300; i < 300; ++i)
+        grid.set(i * 64, i * 7 * 64, uint8_t(i & 0xff) | 1);
+    ASSERT_EQ(grid.getNumChunks(), std::size_t(600));
+
+    const cf::ChunkedGrid copy(grid);
+    for (int64_t i = -300; i < 300; ++i) {
+        ASSERT_EQ(grid.get(i * 64, i * 7 * 64), uint8_t(i & 0xff) | 1);
+        ASSERT_EQ(copy.get(i * 64, i * 7 * 64), uint8_t(i & 0xff) | 1);
+    }
+
+    // the pool keeps its memory, reused chunks start with state 0
+    const std::size_t memory = grid.getMemoryUsage();
+    grid.clear();
+    ASSERT_EQ(grid.getNumChunks(), std::size_t(0));
+    int64_t minX, minY, maxX, maxY;
+    ASSERT_FALSE(grid.getBounds(minX, minY, maxX, maxY));
+    grid.set(1, 1, 1);
+    ASSERT_EQ(grid.get(0, 0), 0);
+    ASSERT_LE(grid.getMemoryUsage(), memory);
+    ASSERT_EQ(copy.getNumChunks(), std::size_t(600));
+}
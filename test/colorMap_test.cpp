@@ -0,0 +1,67 @@
+#include "colorMap.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+
+namespace {
+cf::EscapeTime::Result calculateMandelbrot() {
+    cf::EscapeTime fractal;
+    fractal.setMaxIterations(300);
+    fractal.setEscapeRadius(1000.0);
+    return fractal.calculate(150, 100, cf::Interval(-2.2f, 0.8f), cf::Interval(-1.f, 1.f));
+}
+} // namespace
+
+TEST(ColorMap, SmoothIterations) {
+    const auto result = calculateMandelbrot();
+    const std::vector<float> smooth = cf::ColorMap::SmoothIterations(result);
+    for (std::size_t idx = 0; idx < smooth.size(); ++idx) {
+        if (result.isInside(idx))
+            ASSERT_EQ(smooth[idx], -1.f);
+        else {
+            // the fractional part stays within the escape time band
+            ASSERT_GE(smooth[idx], float(result.iterations[idx]) - 1.f);
+            ASSERT_LE(smooth[idx], float(result.iterations[idx]));
+        }
+    }
+}
+
+TEST(ColorMap, LargeEscapeRadius) {
+    // the smooth iteration counts stay within their band for radii, which overflow float norms
+    cf::EscapeTime fractal;
+    fractal.setMaxIterations(300);
+    fractal.setEscapeRadius(1e50);
+    const auto result = fractal.calculate(150, 100, cf::Interval(-2.2f, 0.8f), cf::Interval(-1.f, 1.f));
+    const std::vector<float> smooth = cf::ColorMap::SmoothIterations(result, 2);
+    for (std::size_t idx = 0; idx < smooth.size(); ++idx) {
+        if (result.isInside(idx))
+            continue;
+        ASSERT_GE(smooth[idx], float(result.iterations[idx]) - 1.f);
+        ASSERT_LE(smooth[idx], float(result.iterations[idx]));
+    }
+}
+
+TEST(ColorMap, Equalization) {
+    const auto result = calculateMandelbrot();
+    const std::vector<cf::Color> palette(64, cf::Color::WHITE);
+    cf::ColorMap colorMap(palette);
+    colorMap.setScaling(cf::ColorMap::Scaling::EQUALIZED);
+
+    std::vector<float> positions;
+    for (const float p : colorMap.calculatePositions(result))
+        if (p >= 0.f)
+            positions.push_back(p);
+    ASSERT_FALSE(positions.empty());
+
+    // equalized -> the escaped pixels are spread evenly over [0, 63]
+    std::sort(positions.begin(), positions.end());
+    for (const double quantile : {0.1, 0.25, 0.5, 0.75, 0.9})
+        EXPECT_NEAR(positions[std::size_t(quantile * positions.size())], quantile * 63.0, 0.05 * 63.0);
+
+    colorMap.setScaling(cf::ColorMap::Scaling::CYCLIC);
+    colorMap.setPeriod(10.f);
+    for (const float p : colorMap.calculatePositions(result)) {
+        ASSERT_GE(p, -1.f);
+        ASSERT_LT(p, 64.f);
+    }
+}
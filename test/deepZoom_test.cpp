@@ -0,0 +1,146 @@
+#include "deepZoom.h"
+#include "gtest/gtest.h"
+
+namespace {
+// boundary point of the mandelbrot set, resolved down to a view width of about 1e-90
+const char* CENTER_REAL = "-0.744483565412290404464797651361760163813795067922613257074243005990413844520135675748182056991";
+const char* CENTER_IMAG = "0.099236693556054497621071124224220046613830511700770139857073176331031985123175791385138871069";
+
+uint32_t escapeTimeReference(const cf::FixedPoint& cr, const cf::FixedPoint& ci, uint32_t maxIterations) {
+    cf::FixedPoint zr(cr.getFractionBits()), zi(cr.getFractionBits());
+    for (uint32_t i = 0; i < maxIterations; ++i) {
+        const cf::FixedPoint zr2 = zr * zr;
+        const cf::FixedPoint zi2 = zi * zi;
+        if (zr2.toDouble() + zi2.toDouble() > 4.0)
+            return i;
+        zi = (zr * zi).mul2(1) + ci;
+        zr = zr2 - zi2 + cr;
+    }
+    return maxIterations;
+}
+} // namespace
+
+TEST(FixedPoint, Arithmetic) {
+    const cf::FixedPoint a(1.5, 100), b(-2.25, 100);
+    ASSERT_EQ((a + b).toDouble(), -0.75);
+    ASSERT_EQ((a - b).toDouble(), 3.75);
+    ASSERT_EQ((a * b).toDouble(), -3.375);
+    ASSERT_EQ((-a).toDouble(), -1.5);
+    ASSERT_EQ(a.mul2(3).toDouble(), 12.0);
+    ASSERT_EQ(b.mul2(-2).toDouble(), -0.5625);
+    ASSERT_THROW(a + cf::FixedPoint(1.0, 64), std::runtime_error);
+
+    ASSERT_EQ(cf::FixedPoint::FromString("0.1", 200).toDouble(), 0.1);
+    ASSERT_EQ(cf::FixedPoint::FromString("-12.5", 64).toDouble(), -12.5);
+    ASSERT_THROW(cf::FixedPoint::FromString("1.2.3", 64), std::runtime_error);
+
+    // differences far below double precision
+    const cf::FixedPoint x = cf::FixedPoint::FromString("1.00000000000000000000000000000000000000003", 256);
+    ASSERT_NEAR((x - cf::FixedPoint(1.0, 256)).toDouble(), 3e-41, 1e-55);
+}
+
+TEST(DeepZoom, ShallowZoom) {
+    // has to match the double precision engine
+    const int width = 120, height = 90;
+    cf::DeepZoom deep("-0.5", "0", 3.0);
+    deep.setMaxIterations(500);
+    cf::EscapeTime fractal;
+    fractal.setMaxIterations(500);
+
+    const auto expected = fractal.calculate(width, height, cf::Interval(-2.f, 1.f), cf::Interval(-1.125f, 1.125f));
+    const auto result = deep.calculate(width, height);
+    std::size_t equal = 0;
+    for (std::size_t i = 0; i < result.iterations.size(); ++i)
+        equal += result.iterations[i] == expected.iterations[i];
+    ASSERT_GT(equal, result.iterations.size() * 99 / 100);
+}
+
+TEST(DeepZoom, LargeEscapeRadius) {
+    // |z_n|^2 of escaped pixels reaches radius^4, beyond the range of float
+    cf::DeepZoom deep("-0.5", "0", 3.0);
+    deep.setMaxIterations(200);
+    deep.setEscapeRadius(1e50);
+    const auto result = deep.calculate(64, 48);
+    std::size_t escaped = 0;
+    for (std::size_t idx = 0; idx < result.norms.size(); ++idx) {
+        if (result.isInside(idx))
+            continue;
+        ASSERT_TRUE(std::isfinite(result.norms[idx])) << idx;
+        ASSERT_GT(result.norms[idx], 1e100);
+        ++escaped;
+    }
+    ASSERT_GT(escaped, 2000u);
+}
+
+TEST(DeepZoom, BeyondDoublePrecision) {
+    const double viewWidth = 1e-40;
+    const int size = 16;
+    cf::DeepZoom deep(CENTER_REAL, CENTER_IMAG, viewWidth);
+    deep.setMaxIterations(20000);
+    const auto result = deep.calculate(size, size);
+
+    // double precision can not resolve the view, all pixels would be equal
+    std::vector<uint32_t> iterations = result.iterations;
+    std::sort(iterations.begin(), iterations.end());
+    ASSERT_GT(std::unique(iterations.begin(), iterations.end()) - iterations.begin(), 10);
+
+    // compare some pixels with a full precision iteration
+    const int bits = 200;
+    for (const auto& pixel : {glm::ivec2(0, 0), glm::ivec2(5, 11), glm::ivec2(15, 7)}) {
+        const cf::FixedPoint cr =
+            cf::FixedPoint::FromString(CENTER_REAL, bits) + cf::FixedPoint((pixel.x + 0.5 - 0.5 * size) * viewWidth / size, bits);
+        const cf::FixedPoint ci =
+            cf::FixedPoint::FromString(CENTER_IMAG, bits) + cf::FixedPoint((0.5 * size - pixel.y - 0.5) * viewWidth / size, bits);
+        ASSERT_EQ(result.iterations[std::size_t(pixel.y) * size + pixel.x], escapeTimeReference(cr, ci, 20000));
+    }
+}
+
+TEST(DeepZoom, SeriesApproximation) {
+    const int width = 40, height = 30;
+    cf::DeepZoom deep(CENTER_REAL, CENTER_IMAG, 1e-30);
+    deep.setMaxIterations(20000);
+    deep.setSeriesApproximation(0);
+    const auto expected = deep.calculate(width, height);
+    ASSERT_EQ(expected.skippedIterations, 0u);
+
+    deep.setSeriesApproximation(4);
+    const auto result = deep.calculate(width, height);
+    ASSERT_GT(result.skippedIterations, 1000u);
+    ASSERT_LT(result.evaluations, expected.evaluations / 2);
+
+    // pixels close to the set boundary are chaotic, all others have to match
+    std::size_t equal = 0;
+    for (std::size_t i = 0; i < result.iterations.size(); ++i)
+        equal += result.iterations[i] == expected.iterations[i];
+    ASSERT_GT(equal, result.iterations.size() * 95 / 100);
+}
+
+TEST(DeepZoom, MultiPrecisionEscapeTime) {
+    // double double is sufficient for a view width of 1e-18, quad double for 1e-40 (rounding errors grow with the
+    // number of iterations)
+    const int size = 16;
+    cf::EscapeTime fractal;
+    fractal.setMaxIterations(20000);
+    for (const auto& view : {std::make_pair(cf::EscapeTime::Precision::DOUBLE_DOUBLE, 1e-18),
+                             std::make_pair(cf::EscapeTime::Precision::QUAD_DOUBLE, 1e-40)}) {
+        fractal.setPrecision(view.first);
+        const auto result = fractal.calculate(size, size, cf::QuadDouble::FromString(CENTER_REAL),
+                                              cf::QuadDouble::FromString(CENTER_IMAG), view.second);
+        cf::DeepZoom deep(CENTER_REAL, CENTER_IMAG, view.second);
+        deep.setMaxIterations(20000);
+        const auto expected = deep.calculate(size, size);
+
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < result.iterations.size(); ++i)
+            equal += result.iterations[i] == expected.iterations[i];
+        ASSERT_GT(equal, result.iterations.size() * 95 / 100);
+    }
+
+    // double precision can not resolve the view
+    fractal.setPrecision(cf::EscapeTime::Precision::DOUBLE);
+    const auto result = fractal.calculate(size, size, cf::QuadDouble::FromString(CENTER_REAL),
+                                          cf::QuadDouble::FromString(CENTER_IMAG), 1e-18);
+    std::vector<uint32_t> iterations = result.iterations;
+    std::sort(iterations.begin(), iterations.end());
+    ASSERT_LT(std::unique(iterations.begin(), iterations.end()) - iterations.begin(), 3);
+}
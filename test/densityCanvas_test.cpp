@@ -0,0 +1,66 @@
+#include "densityCanvas.h"
+#include "gtest/gtest.h"
+
+TEST(DensityCanvas, Counts) {
+    // 4 x 2 pixels of size 1, row 0 is the upper half of the y interval
+    cf::DensityCanvas canvas(4, 2, {0.f, 4.f}, {0.f, 2.f});
+    canvas.addPoint(0.5, 1.5);
+    canvas.addPoint(0.9, 1.1);
+    canvas.addPoint(3.5, 0.5, 3);
+    canvas.addPixel(1, 1, 5);
+    canvas.addPoint(2.0, 2.0); // upper bound of y -> row 0
+    // outside of the intervals
+    canvas.addPoint(4.0, 1.0);
+    canvas.addPoint(-0.1, 1.0);
+    canvas.addPoint(1.0, 0.0 - 1e-9);
+    canvas.addPoint(1.0, 2.5);
+
+    const std::vector<uint32_t> expected = {2, 0, 1, 0, //
+                                            0, 5, 0, 3};
+    for (int row = 0; row < 2; ++row)
+        for (int col = 0; col < 4; ++col)
+            ASSERT_EQ(canvas.getCount(col, row), expected[std::size_t(row) * 4 + col]) << col << ", " << row;
+    ASSERT_EQ(canvas.getRow(1)[3], 3u);
+
+    canvas.clear();
+    for (int row = 0; row < 2; ++row)
+        for (int col = 0; col < 4; ++col)
+            ASSERT_EQ(canvas.getCount(col, row), 0u);
+
+    ASSERT_THROW(cf::DensityCanvas(0, 2), std::runtime_error);
+    ASSERT_THROW(cf::DensityCanvas(2, 2, {1.f, 0.f}, {0.f, 1.f}), std::runtime_error);
+    ASSERT_THROW(cf::DensityCanvas(2, 2, {0.f, 1.f}, {1.f, 1.f}), std::runtime_error);
+}
+
+TEST(DensityCanvas, Normalization) {
+    cf::DensityCanvas canvas(3, 2);
+    canvas.addPixel(0, 0, 1);
+    canvas.addPixel(0, 1, 5);
+    canvas.addPixel(1, 1, 3);
+    canvas.addPixel(1, 0, 1);
+
+    // one maximum: the level is log(1 + count) / log(1 + 5), empty pixels are 0
+    const std::vector<int> global = canvas.getLevels(255);
+    ASSERT_EQ(global.size(), 6u);
+    ASSERT_EQ(global[3], 255);
+    ASSERT_NEAR(global[0], 255.0 * std::log(2.0) / std::log(6.0), 1.0);
+    ASSERT_NEAR(global[4], 255.0 * std::log(4.0) / std::log(6.0), 1.0);
+    ASSERT_EQ(global[1], global[0]);
+    ASSERT_EQ(global[2], 0);
+    ASSERT_EQ(global[5], 0);
+
+    // the maximum of every column gets the highest level
+    const std::vector<int> perColumn = canvas.getLevels(255, cf::DensityCanvas::Normalization::PER_COLUMN);
+    ASSERT_EQ(perColumn[3], 255);
+    ASSERT_EQ(perColumn[4], 255);
+    ASSERT_EQ(perColumn[0], global[0]);
+    ASSERT_NEAR(perColumn[1], 255.0 * std::log(2.0) / std::log(4.0), 1.0);
+    ASSERT_EQ(perColumn[2], 0);
+
+    // a single hit next to a large maximum is still visible
+    canvas.addPixel(2, 0, 1000000);
+    const std::vector<int> levels = canvas.getLevels(3);
+    ASSERT_EQ(levels[0], 1);
+    ASSERT_EQ(levels[2], 3);
+    ASSERT_EQ(levels[5], 0);
+}
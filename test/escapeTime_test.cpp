@@ -0,0 +1,141 @@
+#include "escapeTime.h"
+#include "gtest/gtest.h"
+
+namespace {
+uint32_t escapeTimeReference(std::complex<double> z, const std::complex<double>& c, uint32_t maxIterations) {
+    uint32_t i = 0;
+    for (; i < maxIterations && std::norm(z) <= 4.0; ++i)
+        z = z * z + c;
+    return i;
+}
+} // namespace
+
+TEST(EscapeTime, Mandelbrot) {
+    // odd size -> incomplete lane groups and tiles
+    const int width = 75, height = 67;
+    const cf::Interval range_x(-2.f, 1.f), range_y(-1.5f, 1.5f);
+    cf::EscapeTime fractal;
+    fractal.setMaxIterations(200);
+    fractal.setInteriorDetection(false);
+    const auto result = fractal.calculate(width, height, range_x, range_y);
+    ASSERT_EQ(result.iterations.size(), std::size_t(width * height));
+
+    std::size_t evaluations = 0;
+    for (int row = 0; row < height; ++row) {
+        for (int col = 0; col < width; ++col) {
+            const std::complex<double> c(range_x.min + (col + 0.5) * 3.0 / width, range_y.max - (row + 0.5) * 3.0 / height);
+            const uint32_t expected = escapeTimeReference(0.0, c, 200);
+            ASSERT_EQ(result.iterations[std::size_t(row) * width + col], expected);
+            evaluations += expected;
+        }
+    }
+    ASSERT_EQ(result.evaluations, evaluations);
+}
+
+TEST(EscapeTime, Julia) {
+    // c = 0 -> the unit disk is the filled julia set
+    const auto result = cf::EscapeTime::Julia(0.0).calculate(40, 40, cf::Interval(-2.f, 2.f), cf::Interval(-2.f, 2.f));
+    for (int row = 0; row < 40; ++row) {
+        for (int col = 0; col < 40; ++col) {
+            const double x = -2.0 + (col + 0.5) * 0.1, y = 2.0 - (row + 0.5) * 0.1;
+            ASSERT_EQ(result.isInside(std::size_t(row) * 40 + col), x * x + y * y < 1.0);
+        }
+    }
+}
+
+TEST(EscapeTime, LargeEscapeRadius) {
+    // |z_n|^2 of escaped pixels reaches radius^4, beyond the range of float for radii > 1e9
+    for (double radius : {1e10, 1e20, 1e50}) {
+        cf::EscapeTime fractal;
+        fractal.setMaxIterations(200);
+        fractal.setEscapeRadius(radius);
+        const auto result = fractal.calculate(64, 48, cf::Interval(-2.f, 1.f), cf::Interval(-1.2f, 1.2f));
+        std::size_t escaped = 0;
+        for (std::size_t idx = 0; idx < result.norms.size(); ++idx) {
+            if (result.isInside(idx))
+                continue;
+            ASSERT_TRUE(std::isfinite(result.norms[idx])) << radius << ' ' << idx;
+            ASSERT_GT(result.norms[idx], radius * radius);
+            ++escaped;
+        }
+        ASSERT_GT(escaped, 2000u);
+    }
+}
+
+TEST(EscapeTime, Modes) {
+    // interior heavy view: main cardioid and period 2 bulb
+    const int width = 300, height = 200;
+    const cf::Interval range_x(-1.6f, 0.4f), range_y(-0.65f, 0.65f);
+    cf::EscapeTime fractal;
+    fractal.setMaxIterations(500);
+    fractal.setInteriorDetection(false);
+    const auto full = fractal.calculate(width, height, range_x, range_y);
+    ASSERT_EQ(full.computedPixels, full.iterations.size());
+
+    for (const auto mode : {cf::EscapeTime::Mode::MARIANI_SILVER, cf::EscapeTime::Mode::BOUNDARY_TRACING}) {
+        fractal.setMode(mode);
+        const auto result = fractal.calculate(width, height, range_x, range_y);
+        std::size_t equal = 0;
+        for (std::size_t idx = 0; idx < full.iterations.size(); ++idx)
+            equal += result.iterations[idx] == full.iterations[idx];
+
+        EXPECT_GE(double(equal), 0.995 * full.iterations.size());
+        EXPECT_LT(double(result.computedPixels), 0.6 * full.iterations.size());
+        EXPECT_LT(result.evaluations, full.evaluations / 3);
+    }
+}
+
+TEST(EscapeTime, InteriorDetection) {
+    const cf::Interval range_x(-2.f, 1.f), range_y(-1.5f, 1.5f);
+    for (auto fractal : {cf::EscapeTime(), cf::EscapeTime::Julia({-0.12, 0.75})}) {
+        fractal.setMaxIterations(5000);
+        fractal.setInteriorDetection(false);
+        const auto expected = fractal.calculate(120, 120, range_x, range_y);
+        fractal.setInteriorDetection(true);
+        const auto result = fractal.calculate(120, 120, range_x, range_y);
+
+        ASSERT_EQ(result.iterations, expected.iterations);
+        EXPECT_LT(result.evaluations, expected.evaluations / 4);
+    }
+    ASSERT_THROW(cf::EscapeTime().setInteriorDetection(true, -1.0), std::runtime_error);
+}
+
+TEST(EscapeTime, DistanceEstimation) {
+    // c = 0 -> the unit circle is the Julia set, the estimate is within a factor of 2 of the exact distance
+    auto fractal = cf::EscapeTime::Julia(0.0);
+    fractal.setEscapeRadius(1e10);
+    fractal.setDistanceEstimation(true);
+    const auto result = fractal.calculate(40, 40, cf::Interval(-2.f, 2.f), cf::Interval(-2.f, 2.f));
+    ASSERT_EQ(result.distances.size(), result.iterations.size());
+    for (int row = 0; row < 40; ++row) {
+        for (int col = 0; col < 40; ++col) {
+            const double x = -2.0 + (col + 0.5) * 0.1, y = 2.0 - (row + 0.5) * 0.1;
+            const double distance = std::sqrt(x * x + y * y) - 1.0;
+            const float estimate = result.distances[std::size_t(row) * 40 + col];
+            if (distance < 0.0)
+                ASSERT_EQ(estimate, 0.f);
+            else {
+                ASSERT_GT(estimate, 0.5 * distance);
+                ASSERT_LT(estimate, 2.0 * distance);
+            }
+        }
+    }
+
+    // the derivative tracking does not change the iterations, filling is restricted to the interior
+    cf::EscapeTime mandelbrot;
+    mandelbrot.setMaxIterations(500);
+    const cf::Interval range_x(-2.f, 1.f), range_y(-1.5f, 1.5f);
+    const auto expected = mandelbrot.calculate(100, 100, range_x, range_y);
+    mandelbrot.setDistanceEstimation(true);
+    const auto full = mandelbrot.calculate(100, 100, range_x, range_y);
+    ASSERT_EQ(full.iterations, expected.iterations);
+    for (std::size_t idx = 0; idx < full.distances.size(); ++idx)
+        ASSERT_EQ(full.distances[idx] > 0.f, !full.isInside(idx));
+
+    mandelbrot.setMode(cf::EscapeTime::Mode::BOUNDARY_TRACING);
+    const auto traced = mandelbrot.calculate(100, 100, range_x, range_y);
+    std::size_t equal = 0;
+    for (std::size_t idx = 0; idx < full.distances.size(); ++idx)
+        equal += traced.distances[idx] == full.distances[idx];
+    EXPECT_GE(double(equal), 0.99 * full.distances.size());
+}
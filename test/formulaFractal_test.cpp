@@ -0,0 +1,130 @@
+#include "formulaFractal.h"
+#include "gtest/gtest.h"
+
+namespace {
+template <typename _Step> uint32_t escapeTimeReference(std::complex<double> z, const _Step& step, uint32_t maxIterations) {
+    std::complex<double> previous = 0.0;
+    uint32_t i = 0;
+    for (; i < maxIterations && std::norm(z) <= 4.0; ++i) {
+        const std::complex<double> next = step(z, previous);
+        previous = z;
+        z = next;
+    }
+    return i;
+}
+
+std::complex<double> pixel(int col, int row, int width, int height, const cf::Interval& range_x,
+                           const cf::Interval& range_y) {
+    // same rounding as the engine (chaotic pixels amplify every difference)
+    const double stepX = (double(range_x.max) - double(range_x.min)) / width;
+    const double stepY = (double(range_y.max) - double(range_y.min)) / height;
+    return {range_x.min + (col + 0.5) * stepX, range_y.max - (row + 0.5) * stepY};
+}
+} // namespace
+
+TEST(FormulaFractal, MandelbrotMatchesEscapeTime) {
+    const int width = 75, height = 67;
+    const cf::Interval range_x(-2.f, 1.f), range_y(-1.5f, 1.5f);
+    cf::EscapeTime reference;
+    reference.setMaxIterations(200);
+    reference.setInteriorDetection(false);
+    auto fractal = cf::makeFormulaFractal(cf::formula::mandelbrot());
+    fractal.setMaxIterations(200);
+
+    const auto expected = reference.calculate(width, height, range_x, range_y);
+    const auto result = fractal.calculate(width, height, range_x, range_y);
+    ASSERT_EQ(result.iterations, expected.iterations);
+    ASSERT_EQ(result.evaluations, expected.evaluations);
+    for (std::size_t idx = 0; idx < result.norms.size(); ++idx)
+        ASSERT_NEAR(result.norms[idx], expected.norms[idx], 1e-4 * expected.norms[idx]);
+}
+
+TEST(FormulaFractal, LargeEscapeRadius) {
+    const cf::Interval range_x(-2.f, 1.f), range_y(-1.5f, 1.5f);
+    cf::EscapeTime reference;
+    reference.setMaxIterations(200);
+    reference.setInteriorDetection(false);
+    reference.setEscapeRadius(1e50);
+    auto mandelbrot = cf::makeFormulaFractal(cf::formula::mandelbrot());
+    mandelbrot.setMaxIterations(200);
+    mandelbrot.setEscapeRadius(1e50);
+    const auto expected = reference.calculate(64, 64, range_x, range_y);
+    const auto result = mandelbrot.calculate(64, 64, range_x, range_y);
+    ASSERT_EQ(result.escapeRadius, 1e50);
+    ASSERT_EQ(result.iterations, expected.iterations);
+    for (std::size_t idx = 0; idx < result.norms.size(); ++idx)
+        ASSERT_NEAR(result.norms[idx], expected.norms[idx], 1e-9 * expected.norms[idx]);
+
+    // z^8 overflows beyond about 1e38, the radius is lowered and the norms of escaped pixels stay finite
+    auto multibrot = cf::makeFormulaFractal(cf::formula::multibrot<8>());
+    multibrot.setMaxIterations(200);
+    multibrot.setEscapeRadius(1e50);
+    const auto multi = multibrot.calculate(64, 64, range_x, range_y);
+    ASSERT_LT(multi.escapeRadius, 1e50);
+    ASSERT_GT(multi.escapeRadius, 1e15);
+    std::size_t escaped = 0;
+    for (std::size_t idx = 0; idx < multi.norms.size(); ++idx) {
+        if (multi.isInside(idx))
+            continue;
+        ASSERT_TRUE(std::isfinite(multi.norms[idx])) << idx;
+        ASSERT_GT(multi.norms[idx], multi.escapeRadius * multi.escapeRadius);
+        ++escaped;
+    }
+    ASSERT_GT(escaped, 2000u);
+}
+
+TEST(FormulaFractal, Variants) {
+    const int width = 50, height = 41;
+    const cf::Interval range_x(-2.f, 1.5f), range_y(-1.8f, 1.2f);
+    namespace f = cf::formula;
+
+    auto burningShip = cf::makeFormulaFractal(f::burningShip());
+    auto multibrot = cf::makeFormulaFractal(f::multibrot<5>());
+    auto phoenix = decltype(cf::makeFormulaFractal(f::phoenix(-0.5)))::Julia(f::phoenix(-0.5), {0.5667, 0.1});
+    const auto ship = burningShip.calculate(width, height, range_x, range_y);
+    const auto multi = multibrot.calculate(width, height, range_x, range_y);
+    const auto julia = phoenix.calculate(width, height, range_x, range_y);
+
+    for (int row = 0; row < height; ++row) {
+        for (int col = 0; col < width; ++col) {
+            const std::complex<double> p = pixel(col, row, width, height, range_x, range_y);
+            const std::size_t idx = std::size_t(row) * width + col;
+            const auto shipStep = [&](const std::complex<double>& z, const std::complex<double>&) {
+                const std::complex<double> a(std::abs(z.real()), std::abs(z.imag()));
+                return a * a + p;
+            };
+            const auto multiStep = [&](const std::complex<double>& z, const std::complex<double>&) {
+                const std::complex<double> z2 = z * z;
+                return z2 * z2 * z + p;
+            };
+            const auto phoenixStep = [&](const std::complex<double>& z, const std::complex<double>& previous) {
+                return z * z + std::complex<double>(0.5667, 0.1) - 0.5 * previous;
+            };
+            ASSERT_EQ(ship.iterations[idx], escapeTimeReference(0.0, shipStep, 256));
+            ASSERT_EQ(multi.iterations[idx], escapeTimeReference(0.0, multiStep, 256));
+            ASSERT_EQ(julia.iterations[idx], escapeTimeReference(p, phoenixStep, 256));
+        }
+    }
+}
+
+TEST(FormulaFractal, NewtonRoots) {
+    const int width = 64, height = 64;
+    const cf::Interval range(-1.5f, 1.5f);
+    auto newton = cf::makeFormulaFractal(cf::formula::newton<3>());
+    newton.setMaxIterations(100);
+    const auto basins = newton.calculateRoots(width, height, range, range);
+
+    // the three cubic roots of unity, every pixel converged (none of the pixel centers is a critical point)
+    ASSERT_EQ(basins.rootValues.size(), std::size_t(3));
+    for (const auto& root : basins.rootValues)
+        ASSERT_NEAR(std::norm(std::pow(root, 3.0) - 1.0), 0.0, 1e-12);
+    std::size_t converged = 0;
+    for (const auto& root : basins.roots)
+        converged += root >= 0;
+    ASSERT_EQ(converged, basins.roots.size());
+
+    // the real axis right of 0 belongs to the root 1
+    const std::size_t idx = std::size_t(height / 2) * width + width - 1;
+    ASSERT_NEAR(basins.rootValues[basins.roots[idx]].real(), 1.0, 1e-9);
+    ASSERT_THROW(newton.calculateRoots(0, 10, range, range), std::runtime_error);
+}
@@ -0,0 +1,94 @@
+#include "hashLife.h"
+#include "life.h"
+#include "gtest/gtest.h"
+
+namespace {
+/**
+ * @brief compare Compares all cells of the plane with the cells of HashLife (offset: cell (0, 0) of the plane)
+ */
+void compare(const cf::Life& life, const cf::HashLife& hashLife, int64_t offset) {
+    uint64_t population = 0;
+    for (int y = 0; y < life.getHeight(); ++y) {
+        for (int x = 0; x < life.getWidth(); ++x) {
+            ASSERT_EQ(hashLife.get(x + offset, y + offset), life.get(x, y))
+                << "generation " << life.getGeneration() << " cell " << x << ", " << y;
+            population += life.get(x, y);
+        }
+    }
+    ASSERT_EQ(hashLife.getPopulation(), population);
+    ASSERT_EQ(hashLife.getGeneration(), life.getGeneration());
+}
+} // namespace
+
+TEST(HashLife, MatchesLife) {
+    // soup in the center of a plane, which is large enough for the light cone
+    const int size = 1024, soup = 48;
+    const int64_t offset = -size / 2;
+    cf::Life life(size, size, cf::Life::Topology::PLANE);
+    cf::Life random(soup, soup, cf::Life::Topology::PLANE);
+    random.randomize(0.4, 3);
+    cf::HashLife hashLife;
+    for (int y = 0; y < soup; ++y) {
+        for (int x = 0; x < soup; ++x) {
+            life.set((size - soup) / 2 + x, (size - soup) / 2 + y, random.get(x, y));
+            hashLife.set((size - soup) / 2 + x + offset, (size - soup) / 2 + y + offset, random.get(x, y));
+        }
+    }
+    compare(life, hashLife, offset);
+
+    for (uint64_t generations : {1, 2, 7, 64, 100, 1, 150}) {
+        life.step(generations);
+        hashLife.run(generations);
+        compare(life, hashLife, offset);
+    }
+
+    int64_t minX, minY, maxX, maxY;
+    ASSERT_TRUE(hashLife.getBounds(minX, minY, maxX, maxY));
+    for (int64_t y = minY - 2; y <= maxY + 2; ++y) {
+        ASSERT_EQ(hashLife.get(minX - 1, y), false);
+        ASSERT_EQ(hashLife.get(maxX + 1, y), false);
+    }
+    bool minXAlive = false, maxYAlive = false;
+    for (int64_t y = minY; y <= maxY; ++y)
+        minXAlive |= hashLife.get(minX, y);
+    for (int64_t x = minX; x <= maxX; ++x)
+        maxYAlive |= hashLife.get(x, maxY);
+    ASSERT_TRUE(minXAlive && maxYAlive);
+}
+
+TEST(HashLife, GarbageCollection) {
+    cf::HashLife reference = cf::HashLife::FromDATFile(CHAOS_FILE_PATH "Life2.dat");
+    cf::HashLife limited = reference;
+    limited.setMemoryLimit(1 << 16);
+    for (int i = 0; i < 20; ++i) {
+        reference.run(37);
+        limited.run(37);
+    }
+    ASSERT_EQ(limited.getPopulation(), reference.getPopulation());
+    int64_t minX, minY, maxX, maxY, limitedMinX, limitedMinY, limitedMaxX, limitedMaxY;
+    ASSERT_TRUE(reference.getBounds(minX, minY, maxX, maxY));
+    ASSERT_TRUE(limited.getBounds(limitedMinX, limitedMinY, limitedMaxX, limitedMaxY));
+    ASSERT_EQ(minX, limitedMinX);
+    ASSERT_EQ(maxY, limitedMaxY);
+    for (int64_t y = minY; y <= maxY; ++y)
+        for (int64_t x = minX; x <= maxX; ++x)
+            ASSERT_EQ(limited.get(x, y), reference.get(x, y));
+    ASSERT_LT(limited.getNumNodes(), reference.getNumNodes());
+
+    reference.collectGarbage(false);
+    ASSERT_EQ(reference.getPopulation(), limited.getPopulation());
+}
+
+TEST(HashLife, Glider) {
+    // a glider moves by (1, 1) every 4 generations: 10^12 generations in a few steps
+    cf::HashLife life;
+    life.load({{1, 0, 1}, {2, 1, 1}, {0, 2, 1}, {1, 2, 1}, {2, 2, 1}});
+    life.run(4000000000000ull);
+    int64_t minX, minY, maxX, maxY;
+    ASSERT_TRUE(life.getBounds(minX, minY, maxX, maxY));
+    ASSERT_EQ(minX, 1000000000000ll);
+    ASSERT_EQ(minY, 1000000000000ll);
+    ASSERT_EQ(maxX, 1000000000002ll);
+    ASSERT_EQ(life.getPopulation(), 5u);
+    ASSERT_TRUE(life.get(1000000000001ll, 1000000000000ll));
+}
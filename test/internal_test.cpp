@@ -0,0 +1,40 @@
+#include "internal.hpp"
+#include "gtest/gtest.h"
+
+#include <thread>
+
+TEST(BoundedQueue, ProducerConsumer) {
+    cf::internal::_BoundedQueue<int> queue(3);
+    std::vector<int> received;
+    std::thread consumer([&]() {
+        int item;
+        while (queue.pop(item))
+            received.push_back(item);
+    });
+
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_TRUE(queue.push(i));
+    queue.close();
+    consumer.join();
+
+    // order is kept, no item is lost
+    ASSERT_EQ(received.size(), 1000u);
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(received[i], i);
+}
+
+TEST(BoundedQueue, Close) {
+    cf::internal::_BoundedQueue<int> queue(2);
+    ASSERT_TRUE(queue.push(1));
+    ASSERT_TRUE(queue.push(2));
+    queue.close();
+
+    // remaining items can be popped, pushing fails (does not block although the queue is full)
+    ASSERT_FALSE(queue.push(3));
+    int item = 0;
+    ASSERT_TRUE(queue.pop(item));
+    ASSERT_EQ(item, 1);
+    ASSERT_TRUE(queue.pop(item));
+    ASSERT_EQ(item, 2);
+    ASSERT_FALSE(queue.pop(item));
+}
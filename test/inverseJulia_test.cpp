@@ -0,0 +1,28 @@
+#include "inverseJulia.h"
+#include "gtest/gtest.h"
+
+TEST(InverseJulia, UnitCircle) {
+    // c = 0 -> the Julia set is the unit circle
+    const int size = 200;
+    for (const unsigned numThreads : {1u, 4u}) {
+        cf::DensityCanvas canvas(size, size, cf::Interval(-1.5f, 1.5f), cf::Interval(-1.5f, 1.5f));
+        cf::InverseJulia julia(0.0);
+        julia.setNumThreads(numThreads);
+        const std::size_t visited = julia.calculate(canvas);
+
+        std::size_t hitPixels = 0;
+        for (int row = 0; row < size; ++row) {
+            for (int col = 0; col < size; ++col) {
+                if (!canvas.getCount(col, row))
+                    continue;
+                ++hitPixels;
+                const double x = -1.5 + (col + 0.5) * 3.0 / size, y = 1.5 - (row + 0.5) * 3.0 / size;
+                ASSERT_NEAR(std::sqrt(x * x + y * y), 1.0, 0.75 * 3.0 / size);
+            }
+        }
+        // the circle crosses about 4 * sqrt(2) * r pixels, the saturation bounds the number of visited points
+        EXPECT_GT(hitPixels, std::size_t(0.9 * 4.0 * size / 3.0 * std::sqrt(2.0)));
+        EXPECT_LT(visited, 2 * 3 * (hitPixels + 512 * 512));
+    }
+    ASSERT_THROW(cf::InverseJulia(0.0).setMaxHits(0), std::runtime_error);
+}
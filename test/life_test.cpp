@@ -0,0 +1,127 @@
+#include "life.h"
+#include "gtest/gtest.h"
+
+#include <set>
+
+namespace {
+/**
+ * @brief stepReference Cell by cell B3/S23 generation
+ */
+std::vector<uint8_t> stepReference(const std::vector<uint8_t>& cells, int width, int height, bool torus) {
+    std::vector<uint8_t> next(cells.size(), 0);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int count = 0;
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    int nx = x + dx, ny = y + dy;
+                    if (torus) {
+                        nx = (nx + width) % width;
+                        ny = (ny + height) % height;
+                    } else if (nx < 0 || ny < 0 || nx >= width || ny >= height) {
+                        continue;
+                    }
+                    count += (dx || dy) && cells[std::size_t(ny) * width + nx];
+                }
+            }
+            const uint8_t alive = cells[std::size_t(y) * width + x];
+            next[std::size_t(y) * width + x] = count == 3 || (alive && count == 2);
+        }
+    }
+    return next;
+}
+
+void compare(int width, int height, cf::Life::Topology topology, unsigned numThreads) {
+    cf::Life life(width, height, topology);
+    life.setNumThreads(numThreads);
+    life.randomize(0.35, 7);
+    std::vector<uint8_t> cells(std::size_t(width) * height);
+    for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
+            cells[std::size_t(y) * width + x] = life.get(x, y);
+
+    for (int generation = 0; generation < 40; ++generation) {
+        life.step();
+        cells = stepReference(cells, width, height, topology == cf::Life::Topology::TORUS);
+        uint64_t population = 0;
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                ASSERT_EQ(life.get(x, y), bool(cells[std::size_t(y) * width + x]))
+                    << width << 'x' << height << " generation " << generation << " cell " << x << ", " << y;
+                population += cells[std::size_t(y) * width + x];
+            }
+        }
+        ASSERT_EQ(life.getPopulation(), population);
+    }
+    ASSERT_EQ(life.getGeneration(), 40u);
+}
+} // namespace
+
+TEST(Life, MatchesReference) {
+    compare(64, 64, cf::Life::Topology::TORUS, 1);
+    compare(192, 150, cf::Life::Topology::TORUS, 3);
+    compare(100, 37, cf::Life::Topology::PLANE, 2);
+    compare(13, 5, cf::Life::Topology::PLANE, 1);
+    ASSERT_THROW(cf::Life(100, 10, cf::Life::Topology::TORUS), std::runtime_error);
+}
+
+TEST(Life, Glider) {
+    // a glider moves by one cell diagonally every 4 generations and wraps around the torus
+    cf::Life life(64, 64);
+    life.load({{1, 0, 1}, {2, 1, 1}, {0, 2, 1}, {1, 2, 1}, {2, 2, 1}}, 10, 20);
+    life.step(4 * 64);
+    for (const glm::ivec2& cell : std::vector<glm::ivec2>{{1, 0}, {2, 1}, {0, 2}, {1, 2}, {2, 2}})
+        ASSERT_TRUE(life.get(cell.x + 10, cell.y + 20));
+    ASSERT_EQ(life.getPopulation(), 5u);
+
+    // Life2.dat contains one cell twice
+    std::set<std::pair<int, int>> cells;
+    for (const glm::vec3& point : cf::readDATFile(CHAOS_FILE_PATH "Life2.dat"))
+        cells.emplace(int(point.x), int(point.y));
+    cf::Life pattern = cf::Life::FromDATFile(CHAOS_FILE_PATH "Life2.dat", 256, 256);
+    ASSERT_EQ(pattern.getPopulation(), cells.size());
+}
+
+TEST(Life, ActiveTiles) {
+    // soups settle into still lifes and oscillators, only the tiles around changes are computed
+    for (cf::Life::Topology topology : {cf::Life::Topology::TORUS, cf::Life::Topology::PLANE}) {
+        cf::Life full(320, 200, topology), active(320, 200, topology);
+        full.setActiveTiles(false);
+        full.randomize(0.3, 11);
+        active.randomize(0.3, 11);
+        active.setNumThreads(3);
+        for (int i = 0; i < 60; ++i) {
+            full.step(17);
+            active.step(17);
+            ASSERT_EQ(active.getWords(), full.getWords()) << "generation " << full.getGeneration();
+            if (i == 30) {
+                // modification of a still region
+                full.set(5, 190, true);
+                active.set(5, 190, true);
+            }
+        }
+
+        // tiles, which differ from two generations ago
+        const std::vector<uint64_t> previous = active.getWords();
+        active.step(2);
+        std::size_t changed = 0;
+        for (int tileY = 0; tileY < 200; tileY += 32) {
+            for (int k = 0; k < active.getWordsPerRow(); ++k) {
+                bool tileChanged = false;
+                for (int y = tileY; y < std::min(200, tileY + 32); ++y)
+                    tileChanged |= previous[std::size_t(y) * active.getWordsPerRow() + k] !=
+                                   active.getWords()[std::size_t(y) * active.getWordsPerRow() + k];
+                changed += tileChanged;
+            }
+        }
+        ASSERT_EQ(active.getNumChangedTiles(), changed);
+    }
+
+    // block and blinker (period 2) on the borders of tiles
+    cf::Life life(256, 128);
+    life.load({{63, 31, 1}, {64, 31, 1}, {63, 32, 1}, {64, 32, 1}, {127, 95, 1}, {128, 95, 1}, {129, 95, 1}});
+    life.step(3);
+    ASSERT_EQ(life.getNumChangedTiles(), 0u);
+    ASSERT_TRUE(life.get(128, 94) && life.get(128, 95) && life.get(128, 96) && life.get(63, 31) && life.get(64, 32));
+    ASSERT_EQ(life.getPopulation(), 7u);
+}
@@ -0,0 +1,100 @@
+#include "lyapunovMap.h"
+#include "gtest/gtest.h"
+
+namespace {
+/**
+ * @brief referenceExponent Largest exponent of one parameter pair, iterated with OrbitMap::Evaluate/Jacobian
+ */
+double referenceExponent(cf::OrbitMap map, glm::dvec2 p, std::size_t transient, std::size_t iterations) {
+    for (std::size_t i = 0; i < transient; ++i)
+        p = map(p);
+    glm::dvec2 tangent(0.6, 0.8);
+    double sum = 0.0;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        tangent = map.jacobian(p) * tangent;
+        p = map(p);
+        const double length = glm::length(tangent);
+        sum += std::log(length);
+        tangent /= length;
+    }
+    return sum / double(iterations);
+}
+} // namespace
+
+TEST(LyapunovMap, LogisticMap) {
+    // sequence "A": the logistic map with the rate of the x axis, every row is the same
+    cf::LyapunovMap lyapunov = cf::LyapunovMap::MarkusLyapunov("A");
+    lyapunov.setIterations(1000, 100000);
+
+    // r = 3.2: period 2 orbit, lambda = ln |r^2 (1 - 2 x1) (1 - 2 x2)| / 2 = ln(4 + 2 r - r^2) / 2
+    // r = 3.83: period 3 window, r -> 4: fully chaotic, lambda = ln 2
+    // (r = 4 itself maps the starting point 0.5 onto the unstable fixed point 0)
+    const std::vector<float> exponents = lyapunov.calculate(3, 2, {3.2f, 4.f}, {0.f, 1.f});
+    ASSERT_EQ(exponents.size(), 6u);
+    const std::vector<float> rates = lyapunov.calculate(1, 1, {3.2f, 3.2f}, {0.f, 1.f});
+    ASSERT_NEAR(rates[0], 0.5 * std::log(4.0 + 2.0 * 3.2 - 3.2 * 3.2), 1e-4);
+    ASSERT_LT(lyapunov.calculate(1, 1, {3.83f, 3.83f}, {0.f, 1.f})[0], 0.f);
+    ASSERT_NEAR(lyapunov.calculate(1, 1, {3.99999f, 3.99999f}, {0.f, 1.f})[0], std::log(2.0), 0.01);
+    for (int col = 0; col < 3; ++col)
+        ASSERT_EQ(exponents[col], exponents[3 + col]) << col;
+
+    // "B" uses the rate of the y axis, "AB" with equal rates is "A"
+    cf::LyapunovMap b = cf::LyapunovMap::MarkusLyapunov("B");
+    b.setIterations(1000, 100000);
+    ASSERT_EQ(b.calculate(1, 1, {0.f, 1.f}, {3.2f, 3.2f})[0], rates[0]);
+    cf::LyapunovMap ab = cf::LyapunovMap::MarkusLyapunov("ab");
+    ab.setIterations(1000, 100000);
+    ASSERT_EQ(ab.calculate(1, 1, {3.2f, 3.2f}, {3.2f, 3.2f})[0], rates[0]);
+
+    ASSERT_THROW(cf::LyapunovMap::MarkusLyapunov("AC"), std::runtime_error);
+    ASSERT_THROW(cf::LyapunovMap::MarkusLyapunov(""), std::runtime_error);
+}
+
+TEST(LyapunovMap, OrbitSlice) {
+    // Henon (x' = 1 + y - d * x^2, y' = 0.3 * x) and a hopalong map (x' = y - sign(x) * sqrt(|g * x - h|), y' = i - x)
+    cf::OrbitMap henon, hopalong;
+    henon.factors[0] = henon.factors[1] = 1.0;
+    henon.factors[3] = -1.4;
+    henon.factors[9] = 0.3;
+    hopalong.factors[1] = 1.0;
+    hopalong.factors[5] = -1.0;
+    hopalong.factors[6] = 0.4;
+    hopalong.factors[7] = 1.0;
+    hopalong.factors[8] = 2.0;
+    hopalong.factors[9] = -1.0;
+
+    struct Slice {
+        cf::OrbitMap map;
+        std::size_t factorX, factorY;
+        cf::Interval range_x, range_y;
+    };
+    for (const Slice& slice : {Slice{henon, 3, 9, {-1.45f, -1.0f}, {0.2f, 0.3f}},
+                               Slice{hopalong, 6, 7, {-1.f, 1.f}, {0.5f, 2.f}}}) {
+        const int width = 19, height = 5; // the last lane group of every row is incomplete
+        cf::LyapunovMap lyapunov(slice.map, {0.1, 0.1}, slice.factorX, slice.factorY);
+        lyapunov.setIterations(100, 2000);
+        lyapunov.setNumThreads(2);
+        const std::vector<float> exponents = lyapunov.calculate(width, height, slice.range_x, slice.range_y);
+
+        const double stepX = (double(slice.range_x.max) - double(slice.range_x.min)) / width;
+        const double stepY = (double(slice.range_y.max) - double(slice.range_y.min)) / height;
+        for (int row = 0; row < height; ++row) {
+            for (int col = 0; col < width; ++col) {
+                cf::OrbitMap map = slice.map;
+                map.factors[slice.factorX] = slice.range_x.min + (col + 0.5) * stepX;
+                map.factors[slice.factorY] = slice.range_y.max - (row + 0.5) * stepY;
+                const double expected = referenceExponent(map, {0.1, 0.1}, 100, 2000);
+                const float exponent = exponents[std::size_t(row) * width + col];
+                if (std::isfinite(expected))
+                    ASSERT_NEAR(exponent, expected, 1e-3 + 1e-3 * std::abs(expected)) << row << ", " << col;
+                else
+                    ASSERT_FALSE(std::isfinite(exponent)) << row << ", " << col;
+            }
+        }
+    }
+
+    // the classic Henon attractor: lambda ~ 0.42
+    cf::LyapunovMap classic(henon, {0.1, 0.1}, 3, 9);
+    classic.setIterations(1000, 100000);
+    ASSERT_NEAR(classic.calculate(1, 1, {-1.4f, -1.4f}, {0.3f, 0.3f})[0], 0.42, 0.01);
+}
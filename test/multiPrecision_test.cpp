@@ -0,0 +1,75 @@
+#include "computerGeometry.hpp"
+#include "gtest/gtest.h"
+
+TEST(MultiPrecision, DoubleDouble) {
+    const cf::DoubleDouble third = cf::DoubleDouble(1.0) / 3.0;
+    ASSERT_NE(third.lo, 0.0);
+    ASSERT_LT(std::abs((third * 3.0 - 1.0).hi), 1e-31);
+
+    const cf::DoubleDouble root = sqrt(cf::DoubleDouble(2.0));
+    ASSERT_LT(std::abs((root * root - 2.0).hi), 1e-31);
+
+    // differences far below double precision
+    const cf::DoubleDouble x = cf::DoubleDouble::FromString("1.000000000000000000000000003");
+    ASSERT_NEAR((x - 1.0).hi, 3e-27, 1e-40);
+    ASSERT_EQ(double(cf::DoubleDouble::FromString("-12.5e-1")), -1.25);
+    ASSERT_THROW(cf::DoubleDouble::FromString("1.2.3"), std::runtime_error);
+    ASSERT_THROW(cf::DoubleDouble::FromString("1e"), std::runtime_error);
+
+    // long double is converted exactly
+    const long double ld = 1.0L / 3.0L;
+    ASSERT_EQ((long double)(cf::DoubleDouble(ld)), ld);
+    ASSERT_TRUE(cf::DoubleDouble(1.0) < cf::DoubleDouble(1.0, 1e-20));
+
+    // 64 bit integers are converted exactly, floating point values up to double have no low part
+    // (integral doubles below 2^64 modulo 2^64)
+    const auto wrap = [](double value) { return value < 0.0 ? uint64_t(0) - uint64_t(-value) : uint64_t(value); };
+    for (const int64_t i : {int64_t(9007199254740993), -int64_t(9007199254740993), std::numeric_limits<int64_t>::min(),
+                            std::numeric_limits<int64_t>::max(), int64_t(-1), int64_t(0)}) {
+        const cf::DoubleDouble d(i);
+        ASSERT_EQ(wrap(d.hi) + wrap(d.lo), uint64_t(i));
+        ASSERT_LE(std::abs(d.lo), std::abs(d.hi) * std::numeric_limits<double>::epsilon() / 2.0);
+        const cf::QuadDouble q(i);
+        ASSERT_EQ(q.c[0], d.hi);
+        ASSERT_EQ(q.c[1], d.lo);
+    }
+    const cf::DoubleDouble u(std::numeric_limits<uint64_t>::max());
+    ASSERT_EQ(u.hi, 18446744073709551616.0);
+    ASSERT_EQ(u.lo, -1.0);
+    ASSERT_EQ(cf::DoubleDouble(0.1f).lo, 0.0);
+    ASSERT_EQ(cf::DoubleDouble(0.1).lo, 0.0);
+    ASSERT_EQ(cf::DoubleDouble(std::numeric_limits<double>::infinity()).lo, 0.0);
+}
+
+TEST(MultiPrecision, QuadDouble) {
+    const cf::QuadDouble third = cf::QuadDouble(1.0) / cf::QuadDouble(3.0);
+    ASSERT_LT(std::abs(double(third * 3.0 - 1.0)), 1e-62);
+
+    const cf::QuadDouble root = sqrt(cf::QuadDouble(2.0));
+    ASSERT_LT(std::abs(double(root * root - 2.0)), 1e-62);
+
+    // components of pi
+    const cf::QuadDouble pi =
+        cf::QuadDouble::FromString("3.14159265358979323846264338327950288419716939937510582097494459230781640628");
+    ASSERT_EQ(pi.c[0], 3.141592653589793116e+00);
+    ASSERT_EQ(pi.c[1], 1.224646799147353207e-16);
+    ASSERT_NEAR(pi.c[2], -2.994769809718339666e-33, 1e-48);
+}
+
+TEST(MultiPrecision, Geometry) {
+    // vectors with components, which differ below double precision
+    const cf::DoubleDouble tiny(1e-20);
+    const cf::PointVector_dd p0(1.0, 1.0), p1(cf::DoubleDouble(1.0) + tiny, 1.0);
+    const cf::DirectionVector_dd direction = p1 - p0;
+    ASSERT_EQ(double(direction.getX()), 1e-20);
+    ASSERT_EQ(double(direction.length()), 1e-20);
+
+    // line through both points (cross product), both points are on it
+    const cf::PointVector_dd line = p0 % p1;
+    ASSERT_EQ(double(line * p0), 0.0);
+    ASSERT_EQ(double(line * p1), 0.0);
+    ASSERT_EQ(double(line.getY()), 1e-20);
+
+    const cf::PointVector_qd q(cf::QuadDouble(2.0), cf::QuadDouble(4.0), cf::QuadDouble(2.0));
+    ASSERT_EQ(cf::PointVector_qd(q).normalize(), cf::PointVector_qd(1.0, 2.0));
+}
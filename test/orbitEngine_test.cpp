@@ -0,0 +1,114 @@
+#include "orbitEngine.h"
+#include "gtest/gtest.h"
+
+TEST(OrbitMap, Henon) {
+    cf::Orbit orb;
+    orb.read(std::string(CHAOS_FILE_PATH) + "Henon.orb");
+    const cf::OrbitMap map(orb);
+
+    // x' = 1 + y - 1.4 * x^2, y' = 0.3 * x
+    const glm::dvec2 p(0.5, -0.2);
+    const glm::dvec2 res = map(p);
+    ASSERT_NEAR(res.x, 1.0 - 0.2 - 1.4 * 0.25, 1e-6);
+    ASSERT_NEAR(res.y, 0.3 * 0.5, 1e-6);
+}
+
+TEST(OrbitMap, Jacobian) {
+    cf::OrbitMap map;
+    const double factors[] = {0.3, 1.1, -0.4, -1.2, 0.7, -1.0, 0.5, 2.0, 0.2, 0.6};
+    std::copy(std::begin(factors), std::end(factors), map.factors.begin());
+
+    // compare with central differences
+    const double h = 1e-6;
+    for (const glm::dvec2& p : {glm::dvec2(0.4, -0.3), glm::dvec2(-1.7, 0.8), glm::dvec2(5.0, 2.0)}) {
+        const glm::dmat2 jacobian = map.jacobian(p);
+        const glm::dvec2 dx = (map(p + glm::dvec2(h, 0.0)) - map(p - glm::dvec2(h, 0.0))) / (2.0 * h);
+        const glm::dvec2 dy = (map(p + glm::dvec2(0.0, h)) - map(p - glm::dvec2(0.0, h))) / (2.0 * h);
+        ASSERT_NEAR(jacobian[0][0], dx.x, 1e-5);
+        ASSERT_NEAR(jacobian[0][1], dx.y, 1e-5);
+        ASSERT_NEAR(jacobian[1][0], dy.x, 1e-5);
+        ASSERT_NEAR(jacobian[1][1], dy.y, 1e-5);
+    }
+}
+
+TEST(OrbitEngine, DisabledCycleDetection) {
+    cf::OrbitMap map;
+    map.factors[0] = 1.0; // constant map -> fixed point (1, 0)
+
+    cf::OrbitEngine engine(map);
+    std::size_t lastIteration = 0;
+    const auto res = engine.iterate({0.0, 0.0}, 1000, [&](const glm::dvec2&, std::size_t iter) { lastIteration = iter; });
+    ASSERT_EQ(res.iterations, 1000u);
+    ASSERT_EQ(res.evaluations, 1000u);
+    ASSERT_EQ(res.period, 0u);
+    ASSERT_EQ(lastIteration, 1000u);
+}
+
+TEST(OrbitEngine, FixedPoint) {
+    cf::OrbitMap map;
+    map.factors[0] = 1.0;
+
+    cf::OrbitEngine engine(map);
+    engine.setCycleDetection(cf::OrbitEngine::CycleHandling::STOP);
+    const auto res = engine.iterate({0.0, 0.0}, 1000);
+    ASSERT_EQ(res.period, 1u);
+    ASSERT_EQ(res.transientLength, 1u);
+    ASSERT_LT(res.iterations, 10u);
+}
+
+TEST(OrbitEngine, ReplayCycle) {
+    // (x, y) -> (y, x) has period 2 for x != y
+    cf::OrbitMap map;
+    map.factors[1] = 1.0;
+    map.factors[9] = 1.0;
+
+    cf::OrbitEngine engine(map);
+    engine.setCycleDetection(cf::OrbitEngine::CycleHandling::REPLAY);
+
+    std::vector<glm::dvec2> points;
+    const auto res = engine.iterate({1.0, 2.0}, 101, [&](const glm::dvec2& p, std::size_t) { points.push_back(p); });
+    ASSERT_EQ(res.period, 2u);
+    ASSERT_EQ(res.transientLength, 0u);
+    ASSERT_EQ(res.iterations, 101u);
+    ASSERT_EQ(points.size(), 101u);
+    ASSERT_LT(res.evaluations, 20u);
+
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        const glm::dvec2 expected = i & 1 ? glm::dvec2(1.0, 2.0) : glm::dvec2(2.0, 1.0);
+        ASSERT_EQ(points[i], expected);
+    }
+}
+
+TEST(OrbitEngine, Divergence) {
+    cf::OrbitMap map;
+    map.factors[3] = 1.0; // x' = x^2
+
+    cf::OrbitEngine engine(map);
+    const auto res = engine.iterate({10.0, 0.0}, 1000);
+    ASSERT_TRUE(res.diverged);
+    ASSERT_LT(res.iterations, 1000u);
+}
+
+TEST(OrbitEngine, Diverged) {
+    cf::OrbitMap map;
+    map.factors[3] = 1e300; // x' = 1e300 * x^2: (1, 0) -> (1e300, 0) -> inf
+
+    cf::OrbitEngine engine(map);
+    std::size_t numPoints = 0;
+    const auto res = engine.iterate({1.0, 0.0}, 1000, [&](const glm::dvec2&, std::size_t) { ++numPoints; });
+    ASSERT_TRUE(res.diverged);
+    ASSERT_EQ(res.iterations, 1u);
+    ASSERT_EQ(res.iterations, numPoints);
+    ASSERT_EQ(res.evaluations, 2u);
+}
+
+TEST(OrbitEngine, CallbackStop) {
+    cf::OrbitMap map;
+    map.factors[0] = 0.5;
+    map.factors[2] = 1.0; // x' = 0.5 + |x|
+
+    cf::OrbitEngine engine(map);
+    const auto res = engine.iterate({0.0, 0.0}, 1000, [](const glm::dvec2& p, std::size_t) { return p.x < 10.0; });
+    ASSERT_EQ(res.iterations, 20u);
+    ASSERT_FALSE(res.diverged);
+}
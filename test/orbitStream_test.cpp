@@ -0,0 +1,115 @@
+#include "orbitStream.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+
+TEST(OrbitStream, RoundTrip) {
+    const std::string path = "orbitStream_test.cfos";
+    cf::Orbit orb;
+    orb.read(std::string(CHAOS_FILE_PATH) + "Henon.orb");
+
+    // three full chunks and one partial chunk
+    const std::size_t numPoints = 3 * cf::OrbitRecorder::CHUNK_RECORDS + 123;
+    std::vector<glm::dvec2> points;
+    {
+        cf::OrbitRecorder recorder(path, 1e-7);
+        cf::OrbitEngine(orb).iterate({0.1, 0.1}, numPoints, [&](const glm::dvec2& p, std::size_t iter) {
+            points.push_back(p);
+            recorder.record(p, iter);
+        });
+        ASSERT_EQ(recorder.getNumRecords(), numPoints);
+    }
+
+    {
+        cf::OrbitStream stream(path);
+        ASSERT_EQ(stream.getNumRecords(), numPoints);
+        ASSERT_EQ(stream.getNumChunks(), 4u);
+
+        std::size_t idx = 0;
+        stream.forEach([&](const cf::OrbitStream::Record& r) {
+            ASSERT_EQ(r.iteration, idx + 1);
+            ASSERT_NEAR(r.point.x, points[idx].x, 0.5e-7 + 1e-12);
+            ASSERT_NEAR(r.point.y, points[idx].y, 0.5e-7 + 1e-12);
+            ++idx;
+        });
+        ASSERT_EQ(idx, numPoints);
+
+        // replay of an iteration range
+        cf::DensityCanvas canvas(64, 64, cf::Interval(-2.f, 2.f), cf::Interval(-2.f, 2.f));
+        stream.setNumThreads(2);
+        stream.replay(canvas, 1000, 99999);
+        uint64_t sum = 0;
+        for (int row = 0; row < canvas.getHeight(); ++row) {
+            for (int col = 0; col < canvas.getWidth(); ++col)
+                sum += canvas.getCount(col, row);
+        }
+        ASSERT_EQ(sum, 99000u);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(OrbitStream, InvalidFile) {
+    const std::string path = "orbitStream_test.invalid";
+    {
+        std::ofstream file(path);
+        file << "no orbit stream";
+    }
+    ASSERT_THROW(cf::OrbitStream stream(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(OrbitStream, CorruptChunk) {
+    const std::string path = "orbitStream_test.corrupt";
+    {
+        cf::OrbitRecorder recorder(path, 0.5);
+        for (std::size_t i = 0; i < 100; ++i)
+            recorder.record({double(i), -double(i)}, i);
+    }
+
+    // header and index are little endian: version 1 follows the magic
+    std::vector<char> bytes;
+    {
+        std::ifstream file(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    ASSERT_GT(bytes.size(), 32u + 24u);
+    ASSERT_EQ(std::string(bytes.data() + 4, 4), std::string("\x01\0\0\0", 4));
+
+    // twelve bytes with continuation bits: a varint longer than 64 bits
+    std::fill(bytes.begin() + 32, bytes.begin() + 32 + 12, char(0xff));
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), std::streamsize(bytes.size()));
+    }
+    {
+        cf::OrbitStream stream(path);
+        ASSERT_EQ(stream.getNumRecords(), 100u);
+        ASSERT_THROW(stream.forEach([](const cf::OrbitStream::Record&) {}), std::runtime_error);
+    }
+
+    // all chunk bytes with continuation bits: the chunk ends within the varint
+    const std::size_t indexOffset = bytes.size() - 24 - sizeof(cf::internal::_OrbitChunkInfo);
+    std::fill(bytes.begin() + 32, bytes.begin() + indexOffset, char(0xff));
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), std::streamsize(bytes.size()));
+    }
+    {
+        cf::OrbitStream stream(path);
+        ASSERT_THROW(stream.forEach([](const cf::OrbitStream::Record&) {}), std::runtime_error);
+    }
+
+    // index values, whose products wrap around: 2^59 + 1 chunks of 32 bytes, 3 * numRecords = 2^65 + 1
+    const auto writeUint64 = [&](std::size_t offset, uint64_t value) {
+        std::vector<char> corrupt = bytes;
+        for (int i = 0; i < 8; ++i)
+            corrupt[offset + i] = char(value >> (8 * i));
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(corrupt.data(), std::streamsize(corrupt.size()));
+    };
+    writeUint64(bytes.size() - 24 + 8, (uint64_t(1) << 59) + 1);
+    ASSERT_THROW(cf::OrbitStream stream(path), std::runtime_error);
+    writeUint64(indexOffset + 8, uint64_t(0xAAAAAAAAAAAAAAABull));
+    ASSERT_THROW(cf::OrbitStream stream(path), std::runtime_error);
+    std::remove(path.c_str());
+}
@@ -0,0 +1,82 @@
+#include "progressiveRenderer.h"
+#include "gtest/gtest.h"
+
+namespace {
+// pixel sizes are powers of two -> panned and zoomed pixel centers coincide exactly
+const int SIZE = 96;
+const cf::Interval RANGE_X(-2.f, 1.f), RANGE_Y(-1.5f, 1.5f);
+} // namespace
+
+TEST(ProgressiveRenderer, Passes) {
+    cf::EscapeTime fractal;
+    fractal.setMaxIterations(300);
+    cf::ProgressiveRenderer renderer(fractal, {cf::Color::WHITE});
+
+    std::vector<int> steps;
+    const auto& result = renderer.calculate(SIZE, SIZE, RANGE_X, RANGE_Y, [&](int step, const cf::EscapeTime::Result& r) {
+        steps.push_back(step);
+        ASSERT_EQ(r.iterations.size(), std::size_t(SIZE * SIZE));
+    });
+    ASSERT_EQ(steps, std::vector<int>({16, 8, 4, 2, 1}));
+    ASSERT_EQ(result.computedPixels, std::size_t(SIZE * SIZE));
+    ASSERT_EQ(renderer.getReusedPixels(), 0u);
+    ASSERT_EQ(result.iterations, fractal.calculate(SIZE, SIZE, RANGE_X, RANGE_Y).iterations);
+}
+
+TEST(ProgressiveRenderer, Reuse) {
+    cf::EscapeTime fractal;
+    fractal.setMaxIterations(300);
+    cf::ProgressiveRenderer renderer(fractal, {cf::Color::WHITE});
+    renderer.calculate(SIZE, SIZE, RANGE_X, RANGE_Y);
+
+    // pan by 10 pixels to the right and 4 pixels down
+    const float step = 3.f / SIZE;
+    const cf::Interval panX(RANGE_X.min + 10 * step, RANGE_X.max + 10 * step), panY(RANGE_Y.min - 4 * step, RANGE_Y.max - 4 * step);
+    const auto& panned = renderer.calculate(SIZE, SIZE, panX, panY);
+    ASSERT_EQ(renderer.getReusedPixels(), std::size_t((SIZE - 10) * (SIZE - 4)));
+    ASSERT_EQ(panned.computedPixels, std::size_t(SIZE * SIZE) - renderer.getReusedPixels());
+    ASSERT_EQ(panned.iterations, fractal.calculate(SIZE, SIZE, panX, panY).iterations);
+
+    // zoom out by 3 around the panned view -> every 3rd pixel center of the panned view is reused
+    const cf::Interval zoomX(panX.min - 3.f, panX.max + 3.f), zoomY(panY.min - 3.f, panY.max + 3.f);
+    const auto& zoomed = renderer.calculate(SIZE, SIZE, zoomX, zoomY);
+    ASSERT_EQ(renderer.getReusedPixels(), std::size_t((SIZE / 3) * (SIZE / 3)));
+    ASSERT_EQ(zoomed.iterations, fractal.calculate(SIZE, SIZE, zoomX, zoomY).iterations);
+
+    // zoom in by 2: no pixel center coincides, every pixel is seeded with the sample of the previous pixel covering it
+    const cf::EscapeTime::Result previous = zoomed;
+    const float centerX = 0.5f * (zoomX.min + zoomX.max), centerY = 0.5f * (zoomY.min + zoomY.max);
+    const float quarterX = 0.25f * (zoomX.max - zoomX.min), quarterY = 0.25f * (zoomY.max - zoomY.min);
+    const cf::Interval inX(centerX - quarterX, centerX + quarterX), inY(centerY - quarterY, centerY + quarterY);
+    bool firstPass = true;
+    const auto& in = renderer.calculate(SIZE, SIZE, inX, inY, [&](int step, const cf::EscapeTime::Result& r) {
+        if (!firstPass)
+            return;
+        firstPass = false;
+        ASSERT_EQ(step, 16);
+        for (int row = 0; row < SIZE; ++row) {
+            for (int col = 0; col < SIZE; ++col) {
+                if (row % 16 || col % 16) {
+                    const std::size_t previousIdx = std::size_t(SIZE / 4 + row / 2) * SIZE + SIZE / 4 + col / 2;
+                    ASSERT_EQ(r.iterations[std::size_t(row) * SIZE + col], previous.iterations[previousIdx]);
+                }
+            }
+        }
+    });
+    ASSERT_EQ(renderer.getReusedPixels(), 0u);
+    ASSERT_EQ(renderer.getSeededPixels(), std::size_t(SIZE * SIZE));
+    ASSERT_EQ(in.computedPixels, std::size_t(SIZE * SIZE));
+    ASSERT_EQ(in.iterations, fractal.calculate(SIZE, SIZE, inX, inY).iterations);
+
+    // zoom out by 2: the center half of the view is seeded
+    const auto& out = renderer.calculate(SIZE, SIZE, zoomX, zoomY);
+    ASSERT_EQ(renderer.getSeededPixels(), std::size_t((SIZE / 2) * (SIZE / 2)));
+    ASSERT_EQ(out.iterations, fractal.calculate(SIZE, SIZE, zoomX, zoomY).iterations);
+
+    // a different fractal discards all samples
+    renderer.setFractal(cf::EscapeTime::Julia({-0.8, 0.156}));
+    renderer.calculate(SIZE, SIZE, zoomX, zoomY);
+    ASSERT_EQ(renderer.getReusedPixels(), 0u);
+    ASSERT_EQ(renderer.getSeededPixels(), 0u);
+    ASSERT_THROW(renderer.setCoarsestStep(3), std::runtime_error);
+}
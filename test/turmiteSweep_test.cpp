@@ -0,0 +1,83 @@
+#include "turmiteSweep.h"
+#include "gtest/gtest.h"
+
+TEST(TurmiteSweep, GeneratedRules) {
+    cf::TurmiteSweep sweep;
+    sweep.addGeneratedRules(4);
+    ASSERT_EQ(sweep.getNumRules(), 8u);
+    ASSERT_THROW(sweep.addGeneratedRules(0), std::runtime_error);
+    ASSERT_THROW(sweep.addRule(""), std::runtime_error);
+}
+
+TEST(TurmiteSweep, MatchesSingleRuns) {
+    const uint64_t budget = 400000;
+    cf::TurmiteSweep sweep;
+    sweep.addFile(CHAOS_FILE_PATH "Ant_0.ant");
+    sweep.addFile(CHAOS_FILE_PATH "Ant_10.ant");
+    sweep.addRule("RLUN", "four states");
+    sweep.addGeneratedRules(3);
+    sweep.setStepBudget(budget);
+    sweep.setNumThreads(3);
+    const std::vector<cf::TurmiteSweep::Result> results = sweep.run();
+    ASSERT_EQ(results.size(), 7u);
+    ASSERT_EQ(results[0].name, "Ant_0");
+    ASSERT_EQ(results[0].rule, cf::readAntString(CHAOS_FILE_PATH "Ant_0.ant"));
+    ASSERT_EQ(results[2].name, "four states");
+    ASSERT_EQ(results[3].name, "100");
+
+    for (const cf::TurmiteSweep::Result& result : results) {
+        cf::Turmite turmite(result.rule);
+        turmite.run(budget);
+        ASSERT_EQ(result.steps, budget);
+
+        int64_t minX, minY, maxX, maxY;
+        ASSERT_EQ(result.empty, !turmite.getBounds(minX, minY, maxX, maxY)) << result.rule;
+        ASSERT_EQ(result.minX, minX) << result.rule;
+        ASSERT_EQ(result.minY, minY) << result.rule;
+        ASSERT_EQ(result.maxX, maxX) << result.rule;
+        ASSERT_EQ(result.maxY, maxY) << result.rule;
+        ASSERT_EQ(result.population, turmite.getPopulation()) << result.rule;
+
+        uint64_t period = 0;
+        int64_t dx = 0, dy = 0;
+        turmite.getHighway(period, dx, dy);
+        ASSERT_EQ(result.highwayPeriod, period) << result.rule;
+        ASSERT_EQ(result.highwayDx, dx) << result.rule;
+        ASSERT_EQ(result.highwayDy, dy) << result.rule;
+    }
+    ASSERT_EQ(results[0].highwayPeriod, 104u); // Langton's ant builds its highway after about 10000 steps
+}
+
+TEST(TurmiteSweep, Thumbnails) {
+    cf::TurmiteSweep sweep;
+    sweep.addGeneratedRules(3);
+    sweep.setStepBudget(20000);
+    sweep.setNumThreads(3);
+    sweep.setQueueSize(1);
+
+    // one thumbnail per rule, passed in the writer thread
+    std::vector<std::string> names;
+    sweep.setThumbnails(24, {cf::Color::BLACK, cf::Color::WHITE, cf::Color::RED},
+                        [&](const cf::TurmiteSweep::Result& result, const cv::Mat& image) {
+                            ASSERT_EQ(image.cols, 24);
+                            ASSERT_EQ(image.rows, 24);
+                            ASSERT_EQ(image.type(), CV_8UC3);
+                            names.push_back(result.name);
+                        });
+    const std::vector<cf::TurmiteSweep::Result> results = sweep.run();
+    ASSERT_EQ(names.size(), results.size());
+    std::sort(names.begin(), names.end());
+    ASSERT_EQ(names, std::vector<std::string>({"100", "101", "110", "111"}));
+
+    // the exception of the callback reaches the caller
+    sweep.setThumbnails(24, {cf::Color::BLACK}, [](const cf::TurmiteSweep::Result&, const cv::Mat&) {
+        throw std::runtime_error("callback failed");
+    });
+    try {
+        sweep.run();
+        FAIL();
+    } catch (const std::runtime_error& error) {
+        ASSERT_STREQ(error.what(), "callback failed");
+    }
+    ASSERT_THROW(sweep.setThumbnails(24, {}, "."), std::runtime_error);
+}
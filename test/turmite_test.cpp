@@ -0,0 +1,171 @@
+#include "turmite.h"
+#include "gtest/gtest.h"
+
+namespace {
+/**
+ * @brief runReference Step by step simulation with cf::Direction
+ */
+std::vector<uint8_t> runReference(const std::string& rule, int width, int height, uint64_t steps, int& x, int& y,
+                                  cf::Direction::AbsoluteDirection& direction) {
+    using Dir = cf::Direction;
+    std::vector<uint8_t> cells(std::size_t(width) * height, 0);
+    x = width / 2;
+    y = height / 2;
+    direction = Dir::AbsoluteDirection::NORTH;
+    for (uint64_t i = 0; i < steps; ++i) {
+        uint8_t& cell = cells[std::size_t(y) * width + x];
+        const char turn = rule[cell];
+        if (turn == '1' || turn == 'R')
+            direction = Dir::getNextiDirection(direction, Dir::RelativeDirection::RIGHT);
+        else if (turn == '0' || turn == 'L')
+            direction = Dir::getNextiDirection(direction, Dir::RelativeDirection::LEFT);
+        else if (turn == 'U')
+            direction = Dir::AbsoluteDirection((int(direction) + 2) % 4);
+        cell = uint8_t((cell + 1) % rule.size());
+
+        switch (direction) {
+        case Dir::AbsoluteDirection::NORTH:
+            y = (y + height - 1) % height;
+            break;
+        case Dir::AbsoluteDirection::EAST:
+            x = (x + 1) % width;
+            break;
+        case Dir::AbsoluteDirection::SOUTH:
+            y = (y + 1) % height;
+            break;
+        default:
+            x = (x + width - 1) % width;
+        }
+    }
+    return cells;
+}
+} // namespace
+
+TEST(Turmite, MatchesReference) {
+    // small torus -> the ant wraps around many times
+    for (const std::string rule : {"10", "100000111000", "RLUN", "110"}) {
+        const int width = 37, height = 23;
+        cf::Turmite turmite(rule, width, height);
+        turmite.run(12345);
+        turmite.run(50000);
+
+        int x, y;
+        cf::Direction::AbsoluteDirection direction;
+        ASSERT_EQ(turmite.getCells(), runReference(rule, width, height, 62345, x, y, direction)) << rule;
+        ASSERT_EQ(turmite.getX(), x);
+        ASSERT_EQ(turmite.getY(), y);
+        ASSERT_EQ(turmite.getDirection(), direction);
+        ASSERT_EQ(turmite.getSteps(), uint64_t(62345));
+    }
+}
+
+TEST(Turmite, Unbounded) {
+    // the ant never reaches the border of the large torus -> same cells
+    for (const std::string rule : {"10", "100000111000"}) {
+        cf::Turmite torus(rule, 1024, 1024), unbounded(rule);
+        torus.run(30000);
+        unbounded.run(123);
+        unbounded.run(30000 - 123);
+        ASSERT_EQ(unbounded.getX(), torus.getX() - 512);
+        ASSERT_EQ(unbounded.getY(), torus.getY() - 512);
+        ASSERT_EQ(unbounded.getDirection(), torus.getDirection());
+        for (int y = 0; y < 1024; ++y)
+            for (int x = 0; x < 1024; ++x)
+                ASSERT_EQ(unbounded.getState(x - 512, y - 512), torus.getState(x, y));
+        ASSERT_TRUE(unbounded.isUnbounded());
+        ASSERT_TRUE(unbounded.getCells().empty());
+    }
+
+    // Langton's ant on its highway leaves every fixed grid, memory follows the touched area
+    cf::Turmite ant("10");
+    ant.run(1000000);
+    ASSERT_GT(std::abs(ant.getX()), 5000);
+    ASSERT_LT(ant.getGrid().getNumChunks(), std::size_t(1000));
+}
+
+TEST(Turmite, Highway) {
+    // skipped highway periods yield the same ant and the same cells as the simulation of every step
+    for (const std::string rule : {"10", "RLUN", "110", "000001101000", "001000111000"}) {
+        cf::Turmite plain(rule), fast(rule);
+        plain.setHighwayDetection(false);
+        for (const uint64_t steps : {300000, 1234567, 777}) {
+            plain.run(steps);
+            fast.run(steps);
+            ASSERT_EQ(fast.getX(), plain.getX()) << rule;
+            ASSERT_EQ(fast.getY(), plain.getY()) << rule;
+            ASSERT_EQ(fast.getDirection(), plain.getDirection()) << rule;
+        }
+
+        uint64_t period;
+        int64_t dx, dy;
+        ASSERT_TRUE(fast.getHighway(period, dx, dy)) << rule;
+        ASSERT_FALSE(plain.getHighway(period, dx, dy));
+
+        // all cells, which were visited without skipping (other cells are 0 in both)
+        for (const cf::ChunkedGrid::Chunk* chunk : plain.getGrid().getChunks()) {
+            for (int y = 0; y < cf::ChunkedGrid::CHUNK_SIZE; ++y) {
+                for (int x = 0; x < cf::ChunkedGrid::CHUNK_SIZE; ++x) {
+                    const int64_t cellX = chunk->x * cf::ChunkedGrid::CHUNK_SIZE + x;
+                    const int64_t cellY = chunk->y * cf::ChunkedGrid::CHUNK_SIZE + y;
+                    ASSERT_EQ(fast.getState(cellX, cellY), chunk->cells[y * cf::ChunkedGrid::CHUNK_SIZE + x]) << rule;
+                }
+            }
+        }
+        int64_t minX, minY, maxX, maxY, fastMinX, fastMinY, fastMaxX, fastMaxY;
+        ASSERT_TRUE(plain.getBounds(minX, minY, maxX, maxY));
+        ASSERT_TRUE(fast.getBounds(fastMinX, fastMinY, fastMaxX, fastMaxY));
+        ASSERT_LE(fastMinX, minX);
+        ASSERT_GE(fastMaxX, maxX);
+        ASSERT_EQ(fast.getPopulation(), plain.getPopulation()) << rule;
+        ASSERT_LT(fast.getGrid().getNumChunks(), plain.getGrid().getNumChunks());
+    }
+
+    // Langton's ant: period 104, 2 cells diagonally
+    cf::Turmite ant("10");
+    ant.run(uint64_t(1e12));
+    uint64_t period;
+    int64_t dx, dy;
+    ASSERT_TRUE(ant.getHighway(period, dx, dy));
+    ASSERT_EQ(period, uint64_t(104));
+    ASSERT_EQ(std::abs(dx), 2);
+    ASSERT_EQ(std::abs(dy), 2);
+    ASSERT_GT(std::abs(ant.getX()), int64_t(1e10) * 1.9);
+    ASSERT_EQ(ant.getSteps(), uint64_t(1e12));
+    ASSERT_THROW(ant.setPosition(0, 0), std::runtime_error);
+}
+
+TEST(Turmite, HighwaySplitRuns) {
+    // the detection does not depend on how the steps are split into calls of 'run'
+    for (const uint64_t steps : {uint64_t(100000), uint64_t(1000), uint64_t(7)}) {
+        cf::Turmite split("10"), single("10");
+        const uint64_t calls = 3000000 / steps;
+        for (uint64_t i = 0; i < calls; ++i)
+            split.run(steps);
+        single.run(calls * steps);
+
+        uint64_t period, singlePeriod;
+        int64_t dx, dy, singleDx, singleDy;
+        ASSERT_TRUE(single.getHighway(singlePeriod, singleDx, singleDy));
+        ASSERT_TRUE(split.getHighway(period, dx, dy)) << steps;
+        ASSERT_EQ(period, singlePeriod);
+        ASSERT_EQ(split.getX(), single.getX()) << steps;
+        ASSERT_EQ(split.getY(), single.getY()) << steps;
+        ASSERT_EQ(split.getDirection(), single.getDirection()) << steps;
+        ASSERT_EQ(split.getPopulation(), single.getPopulation()) << steps;
+    }
+}
+
+TEST(Turmite, LangtonsAnt) {
+    // Langton's ant builds its highway after about 10000 steps, it then moves 2 cells diagonally every 104 steps
+    cf::Turmite turmite(cf::readAntString(CHAOS_FILE_PATH "Ant_0.ant"), 400, 400);
+    ASSERT_EQ(turmite.getNumStates(), 2);
+    turmite.run(11000);
+    const int x = turmite.getX(), y = turmite.getY();
+    turmite.run(104 * 10);
+    ASSERT_EQ(std::abs(turmite.getX() - x), 20);
+    ASSERT_EQ(std::abs(turmite.getY() - y), 20);
+
+    ASSERT_THROW(cf::Turmite("10x", 10, 10), std::runtime_error);
+    ASSERT_THROW(cf::Turmite("", 10, 10), std::runtime_error);
+    ASSERT_THROW(turmite.setPosition(400, 0), std::runtime_error);
+}
@@ -0,0 +1,52 @@
+#include "zoomVideo.h"
+#include "gtest/gtest.h"
+
+TEST(ZoomVideo, StripsOfFrames) {
+    const cf::ZoomVideo video(cf::EscapeTime(), cf::ColorMap({cf::Color::BLACK, cf::Color::WHITE}), {-0.75, 0.1});
+    const int width = 320, height = 180, numFrames = 240;
+    const cf::ZoomVideo::Layout layout = video.getLayout(width, height);
+
+    // square samples at the corners of the first frame, one octave of radii per strip
+    ASSERT_EQ(layout.columns % 16, 0);
+    ASSERT_GE(layout.columns, 2.0 * glm::pi<double>() * layout.halfDiagonal);
+    ASSERT_NEAR(layout.rowsPerStrip / layout.rowsPerUnit, std::log(2.0), 1e-12);
+    ASSERT_NEAR(layout.row(4.0 / width * layout.halfDiagonal), -0.5, 1e-9);
+    ASSERT_NEAR(layout.row(0.5 * 4.0 / width * layout.halfDiagonal), layout.rowsPerStrip - 0.5, 1e-9);
+
+    // the map reaches from the corners of the first frame down to a quarter pixel of the last frame
+    ASSERT_NEAR(video.getPixelSize(width, 0, numFrames), 4.0 / width, 1e-15);
+    ASSERT_NEAR(video.getPixelSize(width, numFrames - 1, numFrames), 1e-10 / width, 1e-22);
+    ASSERT_GE(layout.numStrips * layout.rowsPerStrip, layout.row(1e-10 / width * 0.25));
+
+    int previousFirst = 0, previousLast = 0;
+    for (int frame = 0; frame < numFrames; ++frame) {
+        const double pixelSize = video.getPixelSize(width, frame, numFrames);
+        int first, last;
+        layout.strips(pixelSize, first, last);
+        ASSERT_LE(first, last) << frame;
+        ASSERT_GE(first, 0) << frame;
+        ASSERT_LT(last, layout.numStrips) << frame;
+
+        // strips are only released once: the window of strips moves monotonically and without gaps
+        ASSERT_GE(first, previousFirst) << frame;
+        ASSERT_GE(last, previousLast) << frame;
+        ASSERT_LE(first, previousLast + 1) << frame;
+        previousFirst = first;
+        previousLast = last;
+
+        // the rows interpolated by the corners and the innermost pixels (clamped to the map) are calculated
+        const int numRows = layout.numStrips * layout.rowsPerStrip;
+        const double outer = layout.row(pixelSize * layout.halfDiagonal), inner = layout.row(pixelSize * 0.25);
+        ASSERT_GE(std::max(0, int(std::floor(outer))), first * layout.rowsPerStrip) << frame;
+        ASSERT_LT(std::min(numRows - 1, int(std::floor(inner)) + 1), (last + 1) * layout.rowsPerStrip) << frame;
+    }
+    ASSERT_EQ(previousLast, layout.numStrips - 1);
+
+    ASSERT_THROW(video.getLayout(0, height), std::runtime_error);
+}
+
+TEST(ZoomVideo, FourCC) {
+    // little endian character order like CV_FOURCC
+    ASSERT_EQ(cf::ZoomVideo::FourCC('M', 'J', 'P', 'G'), 0x47504A4D);
+    ASSERT_EQ(cf::ZoomVideo::FourCC('X', 'V', 'I', 'D'), 'X' | 'V' << 8 | 'I' << 16 | 'D' << 24);
+}